@@ -0,0 +1,63 @@
+function results=callbackBenchmark(iterations)
+% CALLBACKBENCHMARK measure the per call overhead of a MATLAB callback
+% raised by HELICS
+%
+% results=callbackBenchmark() runs 20000 time steps for each case
+% results=callbackBenchmark(iterations) runs the specified number of steps
+%
+% A single federate requests every time step with and without a time update
+% callback, the difference is the cost of one callback. Calling the same
+% function handle directly from MATLAB gives the part of that cost spent in
+% MATLAB itself, the remainder is the overhead of the callback trampoline.
+% Run it against two builds of helicsMex to compare them.
+import helics.*
+if (nargin==0)
+    iterations=20000;
+end
+callback=@(newTime,iterating) [];
+
+results.iterations=iterations;
+results.noCallbackTime=runSteps([],iterations);
+results.callbackTime=runSteps(callback,iterations);
+
+% the same handle called from MATLAB with arguments of the same types
+newTime=0;
+iterating=false;
+tic;
+for ii=1:iterations
+    callback(newTime,iterating);
+end
+results.directTime=toc;
+
+results.callbackUs=(results.callbackTime-results.noCallbackTime)/iterations*1e6;
+results.directUs=results.directTime/iterations*1e6;
+results.overheadUs=results.callbackUs-results.directUs;
+fprintf('callback:          %8.3f us/call\n',results.callbackUs);
+fprintf('direct call:       %8.3f us/call\n',results.directUs);
+fprintf('callback overhead: %8.3f us/call\n',results.overheadUs);
+end
+
+function elapsed=runSteps(callback,iterations)
+import helics.*
+fedInfo=helicsCreateFederateInfo();
+helicsFederateInfoSetCoreTypeFromString(fedInfo,'inproc');
+helicsFederateInfoSetCoreInitString(fedInfo,'--autobroker --federates=1');
+helicsFederateInfoSetTimeProperty(fedInfo,HelicsProperties.HELICS_PROPERTY_TIME_PERIOD,1.0);
+fed=helicsCreateValueFederate('callbackBenchmark',fedInfo);
+helicsFederateInfoFree(fedInfo);
+if (~isempty(callback))
+    helicsFederateSetTimeUpdateCallback(fed,callback);
+end
+helicsFederateEnterExecutingMode(fed);
+
+tic;
+for ii=1:iterations
+    helicsFederateRequestTime(fed,ii);
+end
+helicsMex('__pump');
+elapsed=toc;
+
+helicsFederateFinalize(fed);
+helicsFederateFree(fed);
+helicsCloseLibrary();
+end
@@ -0,0 +1,40 @@
+function results=dispatchBenchmark(iterations)
+% DISPATCHBENCHMARK compare the string and int32 function id dispatch paths
+% of helicsMex
+%
+% results=dispatchBenchmark() runs 100000 calls through each path
+% results=dispatchBenchmark(iterations) runs the specified number of calls
+%
+% helicsFederateIsValid is called on a null handle so the time measured is
+% dominated by the mex crossing and the function lookup.
+if (nargin==0)
+    iterations=100000;
+end
+functionName='helicsFederateIsValid';
+stub=fileread(which(['helics.',functionName]));
+functionId=int32(str2double(regexp(stub,'helicsMex\(int32\((\d+)\)','tokens','once')));
+fed=uint64(0);
+
+% warm up both paths before timing
+helicsMex(functionName,fed);
+helicsMex(functionId,fed);
+
+tic;
+for ii=1:iterations
+    helicsMex(functionName,fed);
+end
+results.stringTime=toc;
+
+tic;
+for ii=1:iterations
+    helicsMex(functionId,fed);
+end
+results.idTime=toc;
+
+results.iterations=iterations;
+results.stringCallUs=results.stringTime/iterations*1e6;
+results.idCallUs=results.idTime/iterations*1e6;
+fprintf('string dispatch: %8.3f us/call\n',results.stringCallUs);
+fprintf('int32 dispatch:  %8.3f us/call\n',results.idCallUs);
+fprintf('speedup:         %8.2fx\n',results.stringTime/results.idTime);
+end
@@ -0,0 +1,78 @@
+function results=filterOperatorBenchmark(messageCount)
+% FILTEROPERATORBENCHMARK compare the message throughput of the native
+% filter operators with a filter that calls back into MATLAB
+%
+% results=filterOperatorBenchmark() sends 20000 messages through each filter
+% results=filterOperatorBenchmark(messageCount) sends the specified number
+%
+% Every case sends messageCount messages from port1 to port2 through a custom
+% filter and measures the time until all of them have been delivered.
+import helics.*
+if (nargin==0)
+    messageCount=20000;
+end
+cases={
+    'none',           {};
+    'delay',          {{'delay',struct('delay',0.5)}};
+    'bernoulliLoss',  {{'bernoulliLoss',struct('probability',0.0,'seed',1)}};
+    'tokenBucket',    {{'tokenBucket',struct('rate',1e12,'burst',1e12)}};
+    'truncate',       {{'truncate',struct('maxBytes',8)}};
+    'reroute',        {{'reroute',struct('pattern','^port2$','destination','port2')}};
+    'chain',          {{'delay',struct('delay',0.5)},{'truncate',struct('maxBytes',8)},{'bernoulliLoss',struct('probability',0.0,'seed',1)}};
+    'matlabCallback', 'matlab';
+    };
+results=struct('name',cases(:,1),'seconds',0,'messagesPerSecond',0);
+for ii=1:size(cases,1)
+    [elapsed,received]=runCase(cases{ii,2},messageCount);
+    if (received~=messageCount)
+        warning('%s delivered %d of %d messages',cases{ii,1},received,messageCount);
+    end
+    results(ii).seconds=elapsed;
+    results(ii).messagesPerSecond=received/elapsed;
+    fprintf('%-16s %12.0f msgs/s\n',cases{ii,1},results(ii).messagesPerSecond);
+end
+end
+
+function [elapsed,received]=runCase(operators,messageCount)
+import helics.*
+broker=helicsCreateBroker('inproc','benchbroker','-f2');
+fedInfo=helicsCreateFederateInfo();
+helicsFederateInfoSetCoreTypeFromString(fedInfo,'inproc');
+helicsFederateInfoSetCoreInitString(fedInfo,'--broker=benchbroker --federates=2');
+mFed=helicsCreateMessageFederate('sender',fedInfo);
+fFed=helicsCreateMessageFederate('filter',fedInfo);
+helicsFederateInfoFree(fedInfo);
+
+p1=helicsFederateRegisterGlobalEndpoint(mFed,'port1','');
+p2=helicsFederateRegisterGlobalEndpoint(mFed,'port2','');
+filt=helicsFederateRegisterFilter(fFed,HelicsFilterTypes.HELICS_FILTER_TYPE_CUSTOM,'benchfilter');
+helicsFilterAddSourceTarget(filt,'port1');
+if (ischar(operators))
+    helicsFilterSetCustomCallback(filt,@(message) message);
+else
+    for jj=1:numel(operators)
+        helicsFilterAddNativeOperator(filt,operators{jj}{:});
+    end
+end
+
+helicsFederateEnterExecutingModeAsync(fFed);
+helicsFederateEnterExecutingMode(mFed);
+helicsFederateEnterExecutingModeComplete(fFed);
+
+payload=uint8(1:64);
+tic;
+for jj=1:messageCount
+    helicsEndpointSendBytesTo(p1,payload,'port2');
+end
+helicsFederateRequestTime(mFed,1.0);
+elapsed=toc;
+received=helicsEndpointPendingMessageCount(p2);
+
+helicsFederateFinalize(mFed);
+helicsFederateFinalize(fFed);
+helicsBrokerWaitForDisconnect(broker,2000);
+helicsFederateFree(mFed);
+helicsFederateFree(fFed);
+helicsBrokerFree(broker);
+helicsCloseLibrary();
+end
@@ -0,0 +1,60 @@
+function results=messagePayloadBenchmark(iterations)
+% MESSAGEPAYLOADBENCHMARK measure the cost of reading a message payload
+% into MATLAB for 1 KB, 64 KB and 4 MB payloads
+%
+% results=messagePayloadBenchmark() reads each payload 200 times per method
+% results=messagePayloadBenchmark(iterations) reads each payload the specified
+% number of times
+%
+% helicsMessageGetBytes copies the payload into a char array one byte at a
+% time, helicsMessageGetRawBytes and helicsMessageGetBytesPointer(msg,true)
+% fill a uint8 array with a single memcpy. The times are per read in
+% microseconds along with the resulting throughput in MB/s.
+import helics.*
+if (nargin==0)
+    iterations=200;
+end
+sizes=[1024 65536 4194304];
+methods={'helicsMessageGetBytes',@(msg) helicsMessageGetBytes(msg);
+    'helicsMessageGetRawBytes',@(msg) helicsMessageGetRawBytes(msg);
+    'helicsMessageGetBytesPointer',@(msg) helicsMessageGetBytesPointer(msg,true)};
+
+fedInfo=helicsCreateFederateInfo();
+helicsFederateInfoSetCoreTypeFromString(fedInfo,'inproc');
+helicsFederateInfoSetCoreInitString(fedInfo,'--autobroker --federates=1');
+fed=helicsCreateMessageFederate('payloadBenchmark',fedInfo);
+helicsFederateInfoFree(fedInfo);
+helicsFederateEnterExecutingMode(fed);
+
+results.sizes=sizes;
+results.methods=methods(:,1)';
+results.us=zeros(numel(sizes),size(methods,1));
+for ii=1:numel(sizes)
+    msg=helicsFederateCreateMessage(fed);
+    helicsMessageSetData(msg,uint8(mod(0:sizes(ii)-1,256)));
+    for jj=1:size(methods,1)
+        read=methods{jj,2};
+        read(msg);
+        tic;
+        for kk=1:iterations
+            read(msg);
+        end
+        results.us(ii,jj)=toc/iterations*1e6;
+    end
+    helicsMessageFree(msg);
+end
+results.mbPerSecond=(sizes'/1e6)./(results.us/1e6);
+
+fprintf('%10s','bytes');
+fprintf('%37s',results.methods{:});
+fprintf('\n');
+for ii=1:numel(sizes)
+    fprintf('%10d',sizes(ii));
+    fprintf('%20.2f us %8.0f MB/s',[results.us(ii,:);results.mbPerSecond(ii,:)]);
+    fprintf('\n');
+end
+
+helicsFederateFinalize(fed);
+helicsFederateFree(fed);
+helicsCloseLibrary();
+end
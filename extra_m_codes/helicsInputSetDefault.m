@@ -24,7 +24,7 @@ function  helicsInputSetDefault(varargin)
                end
            else
                if (numel(pubdata)>1)
-                   helicsInputSetDefaultVector(varargin{:});
+                   helicsInputSetDefaultComplexVector(varargin{:});
                else
                    helicsInputSetDefaultComplex(varargin{:});
                end
@@ -38,7 +38,7 @@ function  helicsInputSetDefault(varargin)
                end
            else
                if (numel(pubdata)>1)
-                   helicsInputSetDefaultVector(varargin{:});
+                   helicsInputSetDefaultComplexVector(varargin{1},double(pubdata));
                else
                    helicsInputSetDefaultComplex(varargin{1},double(pubdata));
                end
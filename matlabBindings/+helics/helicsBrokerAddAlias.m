@@ -7,5 +7,5 @@ function varargout = helicsBrokerAddAlias(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerAddAlias', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(247), varargin{:});
 end
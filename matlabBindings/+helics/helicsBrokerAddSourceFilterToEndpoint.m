@@ -7,5 +7,5 @@ function varargout = helicsBrokerAddSourceFilterToEndpoint(varargin)
 % 
 % @param[in,out] err A HelicsError object, can be NULL if the errors are to be ignored.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerAddSourceFilterToEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(125), varargin{:});
 end
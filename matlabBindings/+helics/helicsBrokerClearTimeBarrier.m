@@ -3,5 +3,5 @@ function varargout = helicsBrokerClearTimeBarrier(varargin)
 % 
 % @param broker The broker to clear the barriers on.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerClearTimeBarrier', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(255), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsBrokerClone(varargin)
 % 
 % @return A new reference to the same broker.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerClone', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(121), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsBrokerDestroy(varargin)
 % Disconnect and free a broker.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerDestroy', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(145), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsBrokerFree(varargin)
 % Release the memory associated with a broker.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerFree', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(148), varargin{:});
 end
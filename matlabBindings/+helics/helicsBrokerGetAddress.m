@@ -5,5 +5,5 @@ function varargout = helicsBrokerGetAddress(varargin)
 % 
 % @return A string with the network address of the broker.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerGetAddress', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(137), varargin{:});
 end
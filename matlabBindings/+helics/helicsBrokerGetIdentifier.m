@@ -5,5 +5,5 @@ function varargout = helicsBrokerGetIdentifier(varargin)
 % 
 % @return A string containing the identifier for the broker.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerGetIdentifier', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(135), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsBrokerIsConnected(varargin)
 % 
 % @return HELICS_FALSE if not connected.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerIsConnected', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(123), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsBrokerIsValid(varargin)
 % 
 % @param broker The HelicsBroker object to test.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(122), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsBrokerMakeConnections(varargin)
 % 
 % @param[in,out] err A HelicsError object, can be NULL if the errors are to be ignored.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerMakeConnections', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(127), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsBrokerSetLogFile(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerSetLogFile', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(253), varargin{:});
 end
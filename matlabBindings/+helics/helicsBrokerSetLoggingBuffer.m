@@ -0,0 +1,19 @@
+function varargout = helicsBrokerSetLoggingBuffer(varargin)
+% Collect the log messages of a broker in a buffer instead of calling MATLAB for each message.
+%
+% @details Messages are filtered when they are logged, kept messages are read with
+%        helicsLoggingBufferDrain or delivered in batches to a callback. The callback only runs while
+%        MATLAB waits in a blocking HELICS call or in helicsMex('__pump',timeout).
+%        Calling this again changes the options of the existing buffer, freeing the object removes it.
+%
+% @param broker The broker to buffer the log messages of.
+% @param options Optional, a struct with the buffer options.
+%        'level': the highest log level kept, higher levels are discarded (default all).
+%        'pattern': a regular expression, only messages matching it are kept.
+%        'capacity': the number of messages kept, the oldest are dropped when full (default 10000).
+%        'callback': a function handle called as callback(entries, dropped) with the buffered messages.
+%        'batchSize': deliver to the callback once this many messages are buffered (default 100).
+%        'interval': also deliver to the callback every interval milliseconds (default 0, disabled).
+
+	[varargout{1:nargout}] = helicsMex(int32(512), varargin{:});
+end
@@ -7,5 +7,5 @@ function varargout = helicsBrokerSetLoggingCallback(varargin)
 
 %	@param broker The broker object in which to set the callback.
 %	@param logger A function handle with the signature void(int loglevel, string identifier, string message).
-	[varargout{1:nargout}] = helicsMex('helicsBrokerSetLoggingCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(478), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsBrokerWaitForDisconnect(varargin)
 % 
 % @return HELICS_TRUE if the disconnect was successful, HELICS_FALSE if there was a timeout.
 
-	[varargout{1:nargout}] = helicsMex('helicsBrokerWaitForDisconnect', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(129), varargin{:});
 end
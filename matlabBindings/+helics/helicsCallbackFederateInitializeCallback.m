@@ -1,9 +1,11 @@
 function varargout = helicsCallbackFederateInitializeCallback(varargin)
-	Set callback for initialization.
+%	Set callback for initialization.
 
-	@details This callback will be executed when computing whether to iterate in initialization mode.
+%	@details This callback will be executed when computing whether to iterate in initialization mode.
+%	The callback runs only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),
+%	HELICS waits for it for at most the time set with helicsCallbackSetTimeout and then does not iterate.
 
-	@param fed The federate object in which to set the callback.
-	@param initialize A function handle with the signature HelicsIterationRequest(void).
-	[varargout{1:nargout}] = helicsMex('helicsCallbackFederateInitializeCallback', varargin{:});
+%	@param fed The federate object in which to set the callback.
+%	@param initialize A function handle with the signature HelicsIterationRequest(void).
+	[varargout{1:nargout}] = helicsMex(int32(494), varargin{:});
 end
@@ -1,9 +1,11 @@
 function varargout = helicsCallbackFederateNextTimeCallback(varargin)
-	Set callback for the next time update=.
+%	Set callback for the next time update=.
 
-	@details This callback will be executed to compute the next time update for a callback federate.
+%	@details This callback will be executed to compute the next time update for a callback federate.
+%	The callback runs only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),
+%	HELICS waits for it for at most the time set with helicsCallbackSetTimeout and then requests the time it passed in.
 
-	@param fed The federate object in which to set the callback.
-	@param timeUpdate A function handle with the signature HelicsTime (HelicsTime time).
-	[varargout{1:nargout}] = helicsMex('helicsCallbackFederateNextTimeCallback', varargin{:});
+%	@param fed The federate object in which to set the callback.
+%	@param timeUpdate A function handle with the signature HelicsTime (HelicsTime time).
+	[varargout{1:nargout}] = helicsMex(int32(492), varargin{:});
 end
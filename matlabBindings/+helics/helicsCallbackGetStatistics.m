@@ -0,0 +1,11 @@
+function varargout = helicsCallbackGetStatistics(varargin)
+% Get the callbacks set from MATLAB with the number of calls and the time spent in MATLAB.
+%
+% @param id Optional, the callback id returned by the function that set the callback (default all).
+%
+% @return A struct array with id, setter, callback, calls, totalSeconds, maxSeconds, meanSeconds and timeouts
+%        fields, timeouts counts the calls skipped because MATLAB did not run them within the time set with
+%        helicsCallbackSetTimeout. A translator callback has one entry per function handle.
+
+	[varargout{1:nargout}] = helicsMex(int32(515), varargin{:});
+end
@@ -0,0 +1,10 @@
+function varargout = helicsCallbackRemove(varargin)
+% Remove a callback set from MATLAB, the callback is cleared in HELICS and its function handle released.
+%
+% @details Calls that were already queued for the MATLAB thread are skipped. The object the callback
+%        was set on must not have been freed.
+%
+% @param id The callback id returned by the function that set the callback.
+
+	[varargout{1:nargout}] = helicsMex(int32(514), varargin{:});
+end
@@ -0,0 +1,13 @@
+function varargout = helicsCallbackSetTimeout(varargin)
+% Set how long HELICS waits for MATLAB to run a callback that returns a value to HELICS.
+%
+% @details Filter, translator, query and callback federate callbacks block the HELICS thread that raises them
+%        until MATLAB runs them, which it only does while it waits inside a blocking HELICS call or in
+%        helicsMex('__pump',timeout). A call MATLAB has not started in time is skipped, a filter then passes
+%        the message through unchanged, a translator leaves its output unchanged, a query is handled as
+%        if its buffer was left empty and a callback federate keeps the time it was given.
+%
+% @param timeout The timeout in milliseconds, negative or Inf waits forever (default 10000).
+
+	[varargout{1:nargout}] = helicsMex(int32(535), varargin{:});
+end
@@ -3,5 +3,5 @@ function varargout = helicsCleanupLibrary(varargin)
 % 
 % @details This runs some cleanup routines and tries to close out any residual thread that haven't been shutdown yet.
 
-	[varargout{1:nargout}] = helicsMex('helicsCleanupLibrary', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(269), varargin{:});
 end
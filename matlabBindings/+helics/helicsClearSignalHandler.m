@@ -1,5 +1,5 @@
 function varargout = helicsClearSignalHandler(varargin)
 % Clear HELICS based signal handlers.
 
-	[varargout{1:nargout}] = helicsMex('helicsClearSignalHandler', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(110), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsCoreAddAlias(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreAddAlias', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(246), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsCoreAddDestinationFilterToEndpoint(varargin)
 % 
 % @param[in,out] err A HelicsError object, can be NULL if the errors are to be ignored.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreAddDestinationFilterToEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(133), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsCoreAddSourceFilterToEndpoint(varargin)
 % 
 % @param[in,out] err A HelicsError object, can be NULL if the errors are to be ignored.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreAddSourceFilterToEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(132), varargin{:});
 end
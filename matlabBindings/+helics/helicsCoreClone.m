@@ -7,5 +7,5 @@ function varargout = helicsCoreClone(varargin)
 % 
 % @return A new reference to the same broker.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreClone', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(117), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsCoreConnect(varargin)
 % 
 % @return HELICS_FALSE if not connected, HELICS_TRUE if it is connected.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreConnect', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(140), varargin{:});
 end
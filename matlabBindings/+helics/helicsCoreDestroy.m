@@ -1,5 +1,5 @@
 function varargout = helicsCoreDestroy(varargin)
 % Disconnect and free a core.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreDestroy', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(146), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsCoreDisconnect(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreDisconnect', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(141), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsCoreFree(varargin)
 % Release the memory associated with a core.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreFree', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(147), varargin{:});
 end
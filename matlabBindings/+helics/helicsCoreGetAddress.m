@@ -5,5 +5,5 @@ function varargout = helicsCoreGetAddress(varargin)
 % 
 % @return A string with the network address of the broker.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreGetAddress', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(138), varargin{:});
 end
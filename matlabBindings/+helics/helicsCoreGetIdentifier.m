@@ -5,5 +5,5 @@ function varargout = helicsCoreGetIdentifier(varargin)
 % 
 % @return A string with the identifier of the core.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreGetIdentifier', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(136), varargin{:});
 end
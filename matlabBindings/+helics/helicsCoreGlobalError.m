@@ -7,5 +7,5 @@ function varargout = helicsCoreGlobalError(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreGlobalError', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(257), varargin{:});
 end
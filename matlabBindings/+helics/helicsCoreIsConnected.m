@@ -5,5 +5,5 @@ function varargout = helicsCoreIsConnected(varargin)
 % 
 % @return HELICS_FALSE if not connected, HELICS_TRUE if it is connected.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreIsConnected', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(130), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsCoreIsValid(varargin)
 % 
 % @param core The HelicsCore object to test.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(118), varargin{:});
 end
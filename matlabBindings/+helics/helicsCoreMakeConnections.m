@@ -6,5 +6,5 @@ function varargout = helicsCoreMakeConnections(varargin)
 % 
 % @param[in,out] err A HelicsError object, can be NULL if the errors are to be ignored.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreMakeConnections', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(134), varargin{:});
 end
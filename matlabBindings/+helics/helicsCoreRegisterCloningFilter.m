@@ -11,5 +11,5 @@ function varargout = helicsCoreRegisterCloningFilter(varargin)
 % 
 % @return A HelicsFilter object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreRegisterCloningFilter', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(438), varargin{:});
 end
@@ -12,5 +12,5 @@ function varargout = helicsCoreRegisterFilter(varargin)
 % 
 % @return A HelicsFilter object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreRegisterFilter', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(437), varargin{:});
 end
@@ -12,5 +12,5 @@ function varargout = helicsCoreRegisterTranslator(varargin)
 % 
 % @return A HelicsTranslator object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreRegisterTranslator', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(459), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsCoreSendCommand(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreSendCommand', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(248), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsCoreSetLogFile(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsCoreSetLogFile', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(252), varargin{:});
 end
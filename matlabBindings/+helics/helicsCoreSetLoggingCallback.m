@@ -7,5 +7,5 @@ function varargout = helicsCoreSetLoggingCallback(varargin)
 
 %	@param core The core object in which to set the callback.
 %	@param logger A function handle with the signature void(int loglevel, string identifier, string message).
-	[varargout{1:nargout}] = helicsMex('helicsCoreSetLoggingCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(479), varargin{:});
 end
@@ -13,5 +13,5 @@ function varargout = helicsCreateBroker(varargin)
 % 
 % It will be NULL if there was an error indicated in the err object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateBroker', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(119), varargin{:});
 end
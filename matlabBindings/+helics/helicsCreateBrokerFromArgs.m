@@ -6,5 +6,5 @@ function varargout = helicsCreateBrokerFromArgs(varargin)
 %	@param arguments The list of string values from a command line.
 
 %	@return A HelicsBroker object.
-	[varargout{1:nargout}] = helicsMex('helicsCreateBrokerFromArgs', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(120), varargin{:});
 end
@@ -10,5 +10,5 @@ function varargout = helicsCreateCallbackFederate(varargin)
 % 
 % @return An opaque value federate object; nullptr if the object creation failed.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateCallbackFederate', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(155), varargin{:});
 end
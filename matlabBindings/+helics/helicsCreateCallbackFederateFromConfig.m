@@ -10,5 +10,5 @@ function varargout = helicsCreateCallbackFederateFromConfig(varargin)
 % 
 % @return An opaque combination federate object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateCallbackFederateFromConfig', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(156), varargin{:});
 end
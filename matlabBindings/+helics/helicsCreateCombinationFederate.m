@@ -11,5 +11,5 @@ function varargout = helicsCreateCombinationFederate(varargin)
 % 
 % @return An opaque value federate object nullptr if the object creation failed.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateCombinationFederate', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(153), varargin{:});
 end
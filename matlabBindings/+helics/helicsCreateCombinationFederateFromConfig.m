@@ -10,5 +10,5 @@ function varargout = helicsCreateCombinationFederateFromConfig(varargin)
 % 
 % @return An opaque combination federate object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateCombinationFederateFromConfig', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(154), varargin{:});
 end
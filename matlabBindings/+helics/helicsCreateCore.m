@@ -12,5 +12,5 @@ function varargout = helicsCreateCore(varargin)
 % 
 % If the core is invalid, err will contain the corresponding error message and the returned object will be NULL.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateCore', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(115), varargin{:});
 end
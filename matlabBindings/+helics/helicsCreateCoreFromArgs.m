@@ -6,5 +6,5 @@ function varargout = helicsCreateCoreFromArgs(varargin)
 %	@param arguments The list of string values from a command line.
 
 %	@return A HelicsCore object.
-	[varargout{1:nargout}] = helicsMex('helicsCreateCoreFromArgs', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(116), varargin{:});
 end
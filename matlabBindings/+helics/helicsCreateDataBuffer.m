@@ -1,5 +1,5 @@
 function varargout = helicsCreateDataBuffer(varargin)
 % create a helics managed data buffer with initial capacity
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateDataBuffer', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(65), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsCreateFederateInfo(varargin)
 % 
 % @return A HelicsFederateInfo object which is a reference to the created object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateFederateInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(161), varargin{:});
 end
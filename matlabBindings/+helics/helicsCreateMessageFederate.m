@@ -11,5 +11,5 @@ function varargout = helicsCreateMessageFederate(varargin)
 % 
 % @return An opaque message federate object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateMessageFederate', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(151), varargin{:});
 end
@@ -10,5 +10,5 @@ function varargout = helicsCreateMessageFederateFromConfig(varargin)
 % 
 % @return An opaque message federate object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateMessageFederateFromConfig', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(152), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsCreateQuery(varargin)
 % @param target The name of the target to query.
 % @param query The query to make of the target.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateQuery', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(258), varargin{:});
 end
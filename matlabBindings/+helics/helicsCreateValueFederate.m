@@ -10,5 +10,5 @@ function varargout = helicsCreateValueFederate(varargin)
 % 
 % @return An opaque value federate object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateValueFederate', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(149), varargin{:});
 end
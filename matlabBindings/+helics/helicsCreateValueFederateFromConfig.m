@@ -9,5 +9,5 @@ function varargout = helicsCreateValueFederateFromConfig(varargin)
 % 
 % @return An opaque value federate object.
 
-	[varargout{1:nargout}] = helicsMex('helicsCreateValueFederateFromConfig', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(150), varargin{:});
 end
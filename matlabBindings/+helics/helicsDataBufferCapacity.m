@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferCapacity(varargin)
 % get the data buffer capacity
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferCapacity', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(70), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferConvertToType(varargin)
 % @param newDataType the type that it is desired for the buffer to be converted to
 % @return true if the conversion was successful
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferConvertToType', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(101), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferData(varargin)
 % get a pointer to the raw data
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferData', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(71), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromBoolean(varargin)
 % @param value the value to serialize into the dataBuffer
 % @return the buffer size after filling
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromBoolean', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(78), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromChar(varargin)
 % @param value the value to serialize into the dataBuffer
 % @return the buffer size after filling
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromChar', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(79), varargin{:});
 end
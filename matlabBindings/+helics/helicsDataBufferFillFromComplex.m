@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromComplex(varargin)
 %	@param data The helicsDataBuffer to fill.
 %	@param value The complex value.
 %	@return int The buffer size.
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromComplex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(81), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromComplexVector(varargin)
 %	@param data The helicsDataBuffer to fill.
 %	@param value The vector of complex values.
 %	@return int The buffer size.
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromComplexVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(85), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromDouble(varargin)
 % @param value the value to serialize into the dataBuffer
 % @return the buffer size after filling
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromDouble', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(75), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromInteger(varargin)
 % @param value the value to serialize into the dataBuffer
 % @return the buffer size after filling
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromInteger', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(74), varargin{:});
 end
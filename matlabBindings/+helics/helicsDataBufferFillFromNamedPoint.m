@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromNamedPoint(varargin)
 % @param value the value to serialize into the dataBuffer
 % @return the buffer size after filling
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromNamedPoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(84), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromRawString(varargin)
 % @param value the value to serialize into the dataBuffer
 % @return the buffer size after filling
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromRawString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(77), varargin{:});
 end
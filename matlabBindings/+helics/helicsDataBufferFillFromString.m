@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromString(varargin)
 % @param value the value to serialize into the dataBuffer
 % @return the buffer size after filling
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(76), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromTime(varargin)
 % @param value the value to serialize into the dataBuffer
 % @return the buffer size after filling
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromTime', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(80), varargin{:});
 end
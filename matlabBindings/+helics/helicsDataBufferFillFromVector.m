@@ -4,5 +4,5 @@ function varargout = helicsDataBufferFillFromVector(varargin)
 %	@param data The helicsDataBuffer to fill.
 %	@param value The vector of doubles.
 %	@return int The buffer size.
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFillFromVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(83), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferFree(varargin)
 % free a DataBuffer
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferFree', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(68), varargin{:});
 end
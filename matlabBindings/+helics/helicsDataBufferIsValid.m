@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferIsValid(varargin)
 % check whether a buffer is valid
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(66), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferSize(varargin)
 % get the data buffer size
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferSize', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(69), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferToBoolean(varargin)
 % convert a data buffer to a boolean
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToBoolean', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(89), varargin{:});
 end
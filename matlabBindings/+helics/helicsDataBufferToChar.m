@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferToChar(varargin)
 % convert a data buffer to a char
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToChar', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(90), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferToComplex(varargin)
 %	@param ipt The input to get the data for.
 
 %	@return  A complex number.
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToComplex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(96), varargin{:});
 end
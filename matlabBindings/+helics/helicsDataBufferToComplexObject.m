@@ -4,5 +4,5 @@ function varargout = helicsDataBufferToComplexObject(varargin)
 %	@param data The HelicsDataBuffer to get the data for.
 
 %	@return  A complex number.
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToComplexObject', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(95), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferToComplexVector(varargin)
 %	@param data The HelicsDataBuffer to get the vector for.
 
 %	@return a list of complex values.
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToComplexVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(99), varargin{:});
 end
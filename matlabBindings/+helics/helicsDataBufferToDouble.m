@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferToDouble(varargin)
 % convert a data buffer to a double
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToDouble', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(88), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferToInteger(varargin)
 % convert a data buffer to an int
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToInteger', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(87), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferToNamedPoint(varargin)
 %	@param ipt The input to get the result for.
 
 %	@return a string and a double value for the named point
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToNamedPoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(100), varargin{:});
 end
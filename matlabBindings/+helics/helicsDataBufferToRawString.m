@@ -4,5 +4,5 @@ function varargout = helicsDataBufferToRawString(varargin)
 %	@param data The HelicsDataBuffer to get the raw string from.
 
 %	@return the raw string value.
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToRawString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(93), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsDataBufferToString(varargin)
 %	@param data The HelicsDataBuffer to get the string from.
 
 %	@return the string value.
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(92), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferToTime(varargin)
 % convert a data buffer to a time
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToTime', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(94), varargin{:});
 end
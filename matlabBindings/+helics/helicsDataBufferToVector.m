@@ -4,5 +4,5 @@ function varargout = helicsDataBufferToVector(varargin)
 %	@param data The HelicsDataBuffer to get the vector for.
 
 %	@return  a list of floating point values.
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferToVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(98), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferType(varargin)
 % extract the data type from the data buffer, if the type isn't recognized UNKNOWN is returned
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferType', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(86), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsDataBufferVectorSize(varargin)
 % get the number of elements that would be required if a vector were retrieved
 
-	[varargout{1:nargout}] = helicsMex('helicsDataBufferVectorSize', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(97), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsEndpointAddDestinationFilter(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointAddDestinationFilter', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(401), varargin{:});
 end
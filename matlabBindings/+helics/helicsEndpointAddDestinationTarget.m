@@ -6,5 +6,5 @@ function varargout = helicsEndpointAddDestinationTarget(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointAddDestinationTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(398), varargin{:});
 end
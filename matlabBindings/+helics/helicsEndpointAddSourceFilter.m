@@ -6,5 +6,5 @@ function varargout = helicsEndpointAddSourceFilter(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointAddSourceFilter', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(400), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsEndpointAddSourceTarget(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointAddSourceTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(397), varargin{:});
 end
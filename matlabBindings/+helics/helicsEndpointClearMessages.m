@@ -5,5 +5,5 @@ function varargout = helicsEndpointClearMessages(varargin)
 % 
 % @param endpoint The endpoint to clear the message for.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointClearMessages', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(384), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsEndpointCreateMessage(varargin)
 % 
 % @return A new HelicsMessage.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointCreateMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(383), varargin{:});
 end
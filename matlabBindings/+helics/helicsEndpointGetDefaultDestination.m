@@ -5,5 +5,5 @@ function varargout = helicsEndpointGetDefaultDestination(varargin)
 % 
 % @return A string with the default destination.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointGetDefaultDestination', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(370), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsEndpointGetInfo(varargin)
 % 
 % @return A string with the info field string.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointGetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(391), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsEndpointGetMessage(varargin)
 % 
 % @return A message object.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointGetMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(382), varargin{:});
 end
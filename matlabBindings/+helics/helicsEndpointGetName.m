@@ -5,5 +5,5 @@ function varargout = helicsEndpointGetName(varargin)
 % 
 % @return The name of the endpoint.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointGetName', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(389), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsEndpointGetOption(varargin)
 % @param option Integer code for the option to set /ref helics_handle_options.
 % @return the value of the option, for boolean options will be 0 or 1
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointGetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(396), varargin{:});
 end
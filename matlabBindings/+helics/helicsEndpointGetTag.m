@@ -5,5 +5,5 @@ function varargout = helicsEndpointGetTag(varargin)
 % @param tagname The name of the tag to query.
 % @return A string with the tag data.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointGetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(393), varargin{:});
 end
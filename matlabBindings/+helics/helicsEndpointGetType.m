@@ -5,5 +5,5 @@ function varargout = helicsEndpointGetType(varargin)
 % 
 % @return The defined type of the endpoint.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointGetType', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(388), varargin{:});
 end
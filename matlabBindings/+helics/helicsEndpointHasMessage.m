@@ -5,5 +5,5 @@ function varargout = helicsEndpointHasMessage(varargin)
 % 
 % @return HELICS_TRUE if the endpoint has a message, HELICS_FALSE otherwise.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointHasMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(379), varargin{:});
 end
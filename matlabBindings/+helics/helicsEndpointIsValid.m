@@ -5,5 +5,5 @@ function varargout = helicsEndpointIsValid(varargin)
 % 
 % @return HELICS_TRUE if the Endpoint object represents a valid endpoint.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(368), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsEndpointPendingMessageCount(varargin)
 % 
 % @param endpoint The endpoint to query.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointPendingMessageCount', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(381), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsEndpointRemoveTarget(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointRemoveTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(399), varargin{:});
 end
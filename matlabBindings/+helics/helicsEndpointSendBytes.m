@@ -3,5 +3,5 @@ function varargout = helicsEndpointSendBytes(varargin)
 
 %	@param endpoint The endpoint to send the data from.
 %	@param data The data to send.
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSendBytes', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(371), varargin{:});
 end
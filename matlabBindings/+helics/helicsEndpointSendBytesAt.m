@@ -4,5 +4,5 @@ function varargout = helicsEndpointSendBytesAt(varargin)
 %	@param endpoint The endpoint to send the data from.
 %	@param data The data to send.
 %	@param time The time to send the message at.
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSendBytesAt', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(374), varargin{:});
 end
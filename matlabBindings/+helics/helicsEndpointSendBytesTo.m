@@ -4,5 +4,5 @@ function varargout = helicsEndpointSendBytesTo(varargin)
 %	@param endpoint The endpoint to send the data from.
 %	@param data The data to send.
 %	@param dst The destination to send the message to.
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSendBytesTo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(372), varargin{:});
 end
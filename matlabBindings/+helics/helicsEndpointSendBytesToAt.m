@@ -5,5 +5,5 @@ function varargout = helicsEndpointSendBytesToAt(varargin)
 %	@param data The data to send.
 %	@param dst The destination to send the message to.
 %	@param time The time to send the message at.
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSendBytesToAt', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(373), varargin{:});
 end
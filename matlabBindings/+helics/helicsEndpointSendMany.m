@@ -0,0 +1,11 @@
+function varargout = helicsEndpointSendMany(varargin)
+% Send several messages from an endpoint in a single call.
+%
+% @param endpoint The endpoint to send from.
+% @param payloads A cell array with one string or uint8 array per message.
+% @param destinations Optional, a cell array with one destination per message or a single destination for all of
+%        them, empty uses the default destination of the endpoint.
+% @param times Optional, one time per message or a single time for all of them, empty sends at the current time.
+
+	[varargout{1:nargout}] = helicsMex(int32(526), varargin{:});
+end
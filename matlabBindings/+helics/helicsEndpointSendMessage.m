@@ -6,5 +6,5 @@ function varargout = helicsEndpointSendMessage(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSendMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(375), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsEndpointSendMessageZeroCopy(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSendMessageZeroCopy', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(376), varargin{:});
 end
@@ -0,0 +1,10 @@
+function varargout = helicsEndpointSendPooledMessage(varargin)
+% Send a message and return it to the pool it came from.
+%
+% @details The message must not be used after this call, messages that are not from a pool are only sent.
+%
+% @param endpoint The endpoint to send from.
+% @param message A message from helicsFederateGetPooledMessage.
+
+	[varargout{1:nargout}] = helicsMex(int32(529), varargin{:});
+end
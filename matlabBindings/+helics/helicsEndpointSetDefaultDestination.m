@@ -6,5 +6,5 @@ function varargout = helicsEndpointSetDefaultDestination(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSetDefaultDestination', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(369), varargin{:});
 end
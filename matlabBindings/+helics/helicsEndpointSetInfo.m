@@ -6,5 +6,5 @@ function varargout = helicsEndpointSetInfo(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(392), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsEndpointSetOption(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(395), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsEndpointSetTag(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(394), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsEndpointSubscribe(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsEndpointSubscribe', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(377), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsFederateAddAlias(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateAddAlias', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(229), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsFederateAddDependency(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateAddDependency', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(233), varargin{:});
 end
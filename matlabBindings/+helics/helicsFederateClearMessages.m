@@ -5,5 +5,5 @@ function varargout = helicsFederateClearMessages(varargin)
 % 
 % @param fed The federate to clear the message for.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateClearMessages', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(387), varargin{:});
 end
@@ -0,0 +1,7 @@
+function varargout = helicsFederateClearQueryResponses(varargin)
+% Remove every query answer set with helicsFederateSetQueryResponse for a federate.
+%
+% @param fed The federate to clear the answers of.
+
+	[varargout{1:nargout}] = helicsMex(int32(517), varargin{:});
+end
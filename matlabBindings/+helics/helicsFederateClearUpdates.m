@@ -3,5 +3,5 @@ function varargout = helicsFederateClearUpdates(varargin)
 % 
 % @param fed The value federate object for which to clear update flags.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateClearUpdates', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(285), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsFederateClone(varargin)
 % 
 % @return A new reference to the same federate.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateClone', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(157), varargin{:});
 end
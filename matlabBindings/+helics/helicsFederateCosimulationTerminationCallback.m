@@ -5,5 +5,5 @@ function varargout = helicsFederateCosimulationTerminationCallback(varargin)
 
 	@param fed The federate object in which to set the callback.
 	@param cosimTermination A function handle with the signature void(void).
-	[varargout{1:nargout}] = helicsMex('helicsFederateCosimulationTerminationCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(490), varargin{:});
 end
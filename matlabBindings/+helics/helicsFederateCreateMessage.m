@@ -9,5 +9,5 @@ function varargout = helicsFederateCreateMessage(varargin)
 % 
 % @return A HelicsMessage containing the message data.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateCreateMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(386), varargin{:});
 end
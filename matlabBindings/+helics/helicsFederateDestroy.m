@@ -1,5 +1,5 @@
 function varargout = helicsFederateDestroy(varargin)
 % Disconnect and free a federate.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateDestroy', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(144), varargin{:});
 end
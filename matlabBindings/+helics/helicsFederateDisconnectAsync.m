@@ -1,5 +1,5 @@
 function varargout = helicsFederateDisconnectAsync(varargin)
 % Disconnect/finalize the federate in an async call.  This call is identical to helicsFederateFinalizeAsync.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateDisconnectAsync', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(192), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsFederateDisconnectComplete(varargin)
 % Complete the asynchronous disconnect/finalize call.  This call is identical to helicsFederateFinalizeComplete
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateDisconnectComplete', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(193), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateEnterExecutingMode(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateEnterExecutingMode', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(203), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateEnterExecutingModeAsync(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateEnterExecutingModeAsync', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(204), varargin{:});
 end
@@ -10,5 +10,5 @@ function varargout = helicsFederateEnterExecutingModeIterative(varargin)
 % 
 % @return An iteration structure with field containing the time and iteration status.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateEnterExecutingModeIterative', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(206), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsFederateEnterExecutingModeIterativeAsync(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateEnterExecutingModeIterativeAsync', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(207), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsFederateEnterExecutingModeIterativeComplete(varargin)
 % 
 % @return An iteration object containing the iteration time and iteration_status.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateEnterExecutingModeIterativeComplete', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(208), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateEnterInitializingMode(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateEnterInitializingMode', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(196), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsFederateEnterInitializingModeComplete(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateEnterInitializingModeComplete', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(198), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsFederateErrorHandlerCallback(varargin)
 
 	@param fed The federate object in which to set the callback.
 	@param errorHandler A function handle with the signature void(int errorCode, const char* errorString).
-	[varargout{1:nargout}] = helicsMex('helicsFederateErrorHandlerCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(491), varargin{:});
 end
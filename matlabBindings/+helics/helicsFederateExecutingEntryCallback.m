@@ -4,5 +4,5 @@ function varargout = helicsFederateExecutingEntryCallback(varargin)
 
 	@param fed The federate object in which to set the callback.
 	@param executingEntry A function handle with the signature void(void).
-	[varargout{1:nargout}] = helicsMex('helicsFederateExecutingEntryCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(489), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsFederateFinalize(varargin)
 % Disconnect/finalize the federate. This function halts all communication in the federate and disconnects it from the core.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateFinalize', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(188), varargin{:});
 end
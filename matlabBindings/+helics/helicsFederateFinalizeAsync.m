@@ -1,5 +1,5 @@
 function varargout = helicsFederateFinalizeAsync(varargin)
 % Disconnect/finalize the federate in an async call.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateFinalizeAsync', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(189), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsFederateFinalizeComplete(varargin)
 % Complete the asynchronous disconnect/finalize call.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateFinalizeComplete', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(190), varargin{:});
 end
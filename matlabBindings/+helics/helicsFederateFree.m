@@ -1,5 +1,5 @@
 function varargout = helicsFederateFree(varargin)
 % Release the memory associated with a federate.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateFree', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(194), varargin{:});
 end
@@ -0,0 +1,14 @@
+function varargout = helicsFederateGetAllMessages(varargin)
+% Get all the pending messages for all the endpoints of a federate in a single call.
+%
+% @details The messages are freed once they are copied, there is no HelicsMessage to free afterwards.
+%
+% @param fed The federate to receive from.
+% @param maxCount Optional, the most messages to return (default all pending messages).
+% @param columnar Optional, true to return a single struct whose fields hold one entry per message (default false).
+%
+% @return A struct array with the fields of helicsMessageToStruct, source, destination, originalSource,
+%         originalDestination, time, messageID, flags and data.
+
+	[varargout{1:nargout}] = helicsMex(int32(525), varargin{:});
+end
@@ -6,5 +6,5 @@ function varargout = helicsFederateGetCommandSource(varargin)
 % 
 % @return A string with the command for the federate, if the string is empty no command is available.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetCommandSource', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(242), varargin{:});
 end
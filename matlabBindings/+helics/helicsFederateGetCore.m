@@ -6,5 +6,5 @@ function varargout = helicsFederateGetCore(varargin)
 % 
 % @return A core object, nullptr if invalid.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetCore', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(210), varargin{:});
 end
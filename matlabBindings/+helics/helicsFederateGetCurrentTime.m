@@ -6,5 +6,5 @@ function varargout = helicsFederateGetCurrentTime(varargin)
 % 
 % @return The current time of the federate.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetCurrentTime', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(228), varargin{:});
 end
@@ -10,5 +10,5 @@ function varargout = helicsFederateGetEndpoint(varargin)
 % 
 % The object will not be valid and err will contain an error code if no endpoint with the specified name exists.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(366), varargin{:});
 end
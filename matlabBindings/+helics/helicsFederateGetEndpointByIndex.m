@@ -10,5 +10,5 @@ function varargout = helicsFederateGetEndpointByIndex(varargin)
 % 
 % The HelicsEndpoint returned will be NULL if given an invalid index.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetEndpointByIndex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(367), varargin{:});
 end
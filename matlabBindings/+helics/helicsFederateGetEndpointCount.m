@@ -5,5 +5,5 @@ function varargout = helicsFederateGetEndpointCount(varargin)
 % 
 % @return (-1) if fed was not a valid federate, otherwise returns the number of endpoints.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetEndpointCount', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(390), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsFederateGetFilter(varargin)
 % @return A HelicsFilter object, the object will not be valid and err will contain an error code if no filter with the specified name
 % exists.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetFilter', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(440), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateGetFilterByIndex(varargin)
 % 
 % @return A HelicsFilter, which will be NULL if an invalid index is given.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetFilterByIndex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(441), varargin{:});
 end
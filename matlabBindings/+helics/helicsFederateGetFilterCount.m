@@ -5,5 +5,5 @@ function varargout = helicsFederateGetFilterCount(varargin)
 % 
 % @return A count of the number of filters registered through a federate.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetFilterCount', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(439), varargin{:});
 end
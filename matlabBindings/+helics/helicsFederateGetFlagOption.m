@@ -7,5 +7,5 @@ function varargout = helicsFederateGetFlagOption(varargin)
 % 
 % @return The value of the flag.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetFlagOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(226), varargin{:});
 end
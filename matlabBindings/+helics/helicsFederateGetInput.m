@@ -9,5 +9,5 @@ function varargout = helicsFederateGetInput(varargin)
 % @return A HelicsInput object, the object will not be valid and err will contain an error code if no input with the specified
 % key exists.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetInput', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(281), varargin{:});
 end
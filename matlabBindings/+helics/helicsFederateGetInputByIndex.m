@@ -8,5 +8,5 @@ function varargout = helicsFederateGetInputByIndex(varargin)
 % 
 % @return A HelicsInput, which will be NULL if an invalid index.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetInputByIndex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(282), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsFederateGetInputByTarget(varargin)
 % @return A HelicsInput object, the object will not be valid and err will contain an error code if no input with the specified
 % key exists.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetInputByTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(284), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsFederateGetInputCount(varargin)
 % 
 % @return (-1) if fed was not a valid federate otherwise returns the number of inputs.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetInputCount', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(361), varargin{:});
 end
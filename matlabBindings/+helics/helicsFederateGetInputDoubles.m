@@ -0,0 +1,13 @@
+function varargout = helicsFederateGetInputDoubles(varargin)
+% Get the double values and update status of a set of inputs with a single call.
+%
+% @param fed The federate the inputs belong to.
+% @param inputs A uint64 array of input objects.
+% @param clearUpdates Optional, if true the update flag of each input is cleared
+%        after it is read as with helicsInputClearUpdate (default false).
+%
+% @return A column vector of the input values.
+% @return A logical column vector, true for each input that was updated before the call.
+
+	[varargout{1:nargout}] = helicsMex(int32(501), varargin{:});
+end
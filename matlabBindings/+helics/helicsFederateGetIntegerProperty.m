@@ -7,5 +7,5 @@ function varargout = helicsFederateGetIntegerProperty(varargin)
 % 
 % @return The value of the property.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetIntegerProperty', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(227), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsFederateGetMessage(varargin)
 % 
 % @return A HelicsMessage which references the data in the message.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(385), varargin{:});
 end
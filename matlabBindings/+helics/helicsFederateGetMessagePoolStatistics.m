@@ -0,0 +1,9 @@
+function varargout = helicsFederateGetMessagePoolStatistics(varargin)
+% Get the usage counters of the message pool of a federate.
+%
+% @param fed The federate that owns the pool.
+%
+% @return A struct with the fields capacity, reserveSize, available, outstanding, hits, misses and recycled.
+
+	[varargout{1:nargout}] = helicsMex(int32(531), varargin{:});
+end
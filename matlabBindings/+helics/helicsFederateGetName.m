@@ -5,5 +5,5 @@ function varargout = helicsFederateGetName(varargin)
 % 
 % @return A pointer to a string with the name.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetName', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(220), varargin{:});
 end
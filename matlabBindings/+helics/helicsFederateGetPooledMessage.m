@@ -0,0 +1,11 @@
+function varargout = helicsFederateGetPooledMessage(varargin)
+% Get a cleared message from the pool of a federate, a new message is created if the pool is empty.
+%
+% @details Return the message with helicsEndpointSendPooledMessage or helicsMessageReleaseToPool.
+%
+% @param fed The federate that owns the pool.
+%
+% @return A HelicsMessage.
+
+	[varargout{1:nargout}] = helicsMex(int32(528), varargin{:});
+end
@@ -9,5 +9,5 @@ function varargout = helicsFederateGetPublication(varargin)
 % @return A HelicsPublication object, the object will not be valid and err will contain an error code if no publication with the
 % specified key exists.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetPublication', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(279), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateGetPublicationByIndex(varargin)
 % 
 % @return A HelicsPublication.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetPublicationByIndex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(280), varargin{:});
 end
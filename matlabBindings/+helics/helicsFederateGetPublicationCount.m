@@ -3,5 +3,5 @@ function varargout = helicsFederateGetPublicationCount(varargin)
 % 
 % @return (-1) if fed was not a valid federate otherwise returns the number of publications.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetPublicationCount', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(360), varargin{:});
 end
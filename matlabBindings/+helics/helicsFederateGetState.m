@@ -8,5 +8,5 @@ function varargout = helicsFederateGetState(varargin)
 % 
 % @return State the resulting state if the federate is invalid will return HELICS_STATE_UNKNOWN
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetState', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(209), varargin{:});
 end
@@ -10,5 +10,5 @@ function varargout = helicsFederateGetSubscription(varargin)
 % @return A HelicsInput object, the object will not be valid and err will contain an error code if no input with the specified
 % key exists.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetSubscription', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(283), varargin{:});
 end
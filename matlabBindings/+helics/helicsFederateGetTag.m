@@ -6,5 +6,5 @@ function varargout = helicsFederateGetTag(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(232), varargin{:});
 end
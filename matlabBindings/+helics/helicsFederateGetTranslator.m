@@ -9,5 +9,5 @@ function varargout = helicsFederateGetTranslator(varargin)
 % @return A HelicsTranslator object. If no translator with the specified name exists, the object will not be valid and
 % err will contain an error code.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetTranslator', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(461), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateGetTranslatorByIndex(varargin)
 % 
 % @return A HelicsTranslator, which will be NULL if an invalid index is given.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetTranslatorByIndex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(462), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsFederateGetTranslatorCount(varargin)
 % 
 % @return A count of the number of translators registered through a federate.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGetTranslatorCount', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(460), varargin{:});
 end
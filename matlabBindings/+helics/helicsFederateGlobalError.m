@@ -8,5 +8,5 @@ function varargout = helicsFederateGlobalError(varargin)
 % @param errorString A string describing the error.
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateGlobalError', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(186), varargin{:});
 end
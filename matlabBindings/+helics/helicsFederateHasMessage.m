@@ -5,5 +5,5 @@ function varargout = helicsFederateHasMessage(varargin)
 % 
 % @return HELICS_TRUE if the federate has a message waiting, HELICS_FALSE otherwise.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateHasMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(378), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsFederateInfoClone(varargin)
 % 
 %  @return A HelicsFederateInfo object which is a reference to the created object.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateInfoClone', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(162), varargin{:});
 end
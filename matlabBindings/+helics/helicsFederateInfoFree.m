@@ -1,5 +1,5 @@
 function varargout = helicsFederateInfoFree(varargin)
 % Delete the memory associated with a federate info object.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateInfoFree', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(165), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsFederateInfoLoadFromArgs(varargin)
 
 %	@param fi A federateInfo object.
 %	@param arguments A list of strings from the command line.
-	[varargout{1:nargout}] = helicsMex('helicsFederateInfoLoadFromArgs', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(163), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateInfoSetBrokerPort(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateInfoSetBrokerPort', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(174), varargin{:});
 end
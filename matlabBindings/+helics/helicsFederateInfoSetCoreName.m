@@ -6,5 +6,5 @@ function varargout = helicsFederateInfoSetCoreName(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateInfoSetCoreName', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(167), varargin{:});
 end
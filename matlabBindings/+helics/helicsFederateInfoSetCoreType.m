@@ -7,5 +7,5 @@ function varargout = helicsFederateInfoSetCoreType(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateInfoSetCoreType', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(170), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsFederateInfoSetCoreTypeFromString(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateInfoSetCoreTypeFromString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(171), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsFederateInitializingEntryCallback(varargin)
 
 	@param fed The federate object in which to set the callback.
 	@param initializingEntry A function handle with the signature void(HelicsBool iterating).
-	[varargout{1:nargout}] = helicsMex('helicsFederateInitializingEntryCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(488), varargin{:});
 end
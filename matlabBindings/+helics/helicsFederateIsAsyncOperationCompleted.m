@@ -6,5 +6,5 @@ function varargout = helicsFederateIsAsyncOperationCompleted(varargin)
 % 
 % @return HELICS_FALSE if not completed, HELICS_TRUE if completed.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateIsAsyncOperationCompleted', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(202), varargin{:});
 end
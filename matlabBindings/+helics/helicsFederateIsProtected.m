@@ -6,5 +6,5 @@ function varargout = helicsFederateIsProtected(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if the federate was not found.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateIsProtected', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(160), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsFederateIsValid(varargin)
 % 
 % @return HELICS_TRUE if the federate is a valid active federate, HELICS_FALSE otherwise
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(166), varargin{:});
 end
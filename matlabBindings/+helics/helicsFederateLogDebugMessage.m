@@ -6,5 +6,5 @@ function varargout = helicsFederateLogDebugMessage(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateLogDebugMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(238), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsFederateLogErrorMessage(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateLogErrorMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(235), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsFederateLogInfoMessage(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateLogInfoMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(237), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsFederateLogLevelMessage(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateLogLevelMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(239), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsFederateLogWarningMessage(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateLogWarningMessage', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(236), varargin{:});
 end
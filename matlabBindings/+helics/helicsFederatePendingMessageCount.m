@@ -3,5 +3,5 @@ function varargout = helicsFederatePendingMessageCount(varargin)
 % 
 % @param fed The federate to get the number of waiting messages from.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederatePendingMessageCount', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(380), varargin{:});
 end
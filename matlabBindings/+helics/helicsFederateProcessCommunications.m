@@ -6,5 +6,5 @@ function varargout = helicsFederateProcessCommunications(varargin)
 % @param period The length of time to process communications and then return control.
 %
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateProcessCommunications', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(219), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateProtect(varargin)
 % 
 % occurred during the execution of the function, in particular if no federate with the given name exists
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateProtect', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(158), varargin{:});
 end
@@ -0,0 +1,11 @@
+function varargout = helicsFederatePublishComplexVectors(varargin)
+% Publish a complex vector on each publication in a set with a single call.
+%
+% @param fed The federate the publications belong to.
+% @param pubs A uint64 array of publication objects.
+% @param values A cell array with one complex vector per publication or a
+%        complex or real matrix with one column per publication, real values
+%        are published with zero imaginary parts.
+
+	[varargout{1:nargout}] = helicsMex(int32(500), varargin{:});
+end
@@ -0,0 +1,9 @@
+function varargout = helicsFederatePublishDoubles(varargin)
+% Publish a double value on each publication in a set with a single call.
+%
+% @param fed The federate the publications belong to.
+% @param pubs A uint64 array of publication objects.
+% @param values A double array with one value per publication.
+
+	[varargout{1:nargout}] = helicsMex(int32(497), varargin{:});
+end
@@ -6,5 +6,5 @@ function varargout = helicsFederatePublishJSON(varargin)
 % 
 % @param[in,out] err The error object to complete if there is an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederatePublishJSON', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(287), varargin{:});
 end
@@ -0,0 +1,10 @@
+function varargout = helicsFederatePublishVectors(varargin)
+% Publish a vector on each publication in a set with a single call.
+%
+% @param fed The federate the publications belong to.
+% @param pubs A uint64 array of publication objects.
+% @param values A cell array with one double vector per publication or a
+%        double matrix with one column per publication.
+
+	[varargout{1:nargout}] = helicsMex(int32(499), varargin{:});
+end
@@ -11,5 +11,5 @@ function varargout = helicsFederateRegisterCloningFilter(varargin)
 % 
 % @return A HelicsFilter object.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterCloningFilter', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(435), varargin{:});
 end
@@ -13,5 +13,5 @@ function varargout = helicsFederateRegisterEndpoint(varargin)
 % 
 % @return An object containing the endpoint, or nullptr on failure.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(362), varargin{:});
 end
@@ -12,5 +12,5 @@ function varargout = helicsFederateRegisterFilter(varargin)
 % 
 % @return A HelicsFilter object.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterFilter', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(433), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateRegisterFromPublicationJSON(varargin)
 % 
 % @details This would be the same JSON that would be used to publish data.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterFromPublicationJSON', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(286), varargin{:});
 end
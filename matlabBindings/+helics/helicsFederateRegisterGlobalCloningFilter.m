@@ -11,5 +11,5 @@ function varargout = helicsFederateRegisterGlobalCloningFilter(varargin)
 % 
 % @return A HelicsFilter object.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterGlobalCloningFilter', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(436), varargin{:});
 end
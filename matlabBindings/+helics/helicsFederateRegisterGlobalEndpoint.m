@@ -12,5 +12,5 @@ function varargout = helicsFederateRegisterGlobalEndpoint(varargin)
 % 
 % @return An object containing the endpoint, or nullptr on failure.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterGlobalEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(363), varargin{:});
 end
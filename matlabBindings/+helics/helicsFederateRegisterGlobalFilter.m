@@ -12,5 +12,5 @@ function varargout = helicsFederateRegisterGlobalFilter(varargin)
 % 
 % @return A HelicsFilter object.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterGlobalFilter', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(434), varargin{:});
 end
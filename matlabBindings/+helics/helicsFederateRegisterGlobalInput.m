@@ -13,5 +13,5 @@ function varargout = helicsFederateRegisterGlobalInput(varargin)
 % 
 % @return An object containing the input.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterGlobalInput', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(277), varargin{:});
 end
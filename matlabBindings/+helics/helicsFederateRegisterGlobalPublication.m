@@ -13,5 +13,5 @@ function varargout = helicsFederateRegisterGlobalPublication(varargin)
 % 
 % @return An object containing the publication.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterGlobalPublication', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(273), varargin{:});
 end
@@ -13,5 +13,5 @@ function varargout = helicsFederateRegisterGlobalTargetedEndpoint(varargin)
 % 
 % @return An object containing the endpoint, or nullptr on failure.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterGlobalTargetedEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(365), varargin{:});
 end
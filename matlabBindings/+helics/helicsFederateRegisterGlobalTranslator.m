@@ -12,5 +12,5 @@ function varargout = helicsFederateRegisterGlobalTranslator(varargin)
 % 
 % @return A HelicsTranslator object.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterGlobalTranslator', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(458), varargin{:});
 end
@@ -11,5 +11,5 @@ function varargout = helicsFederateRegisterGlobalTypeInput(varargin)
 % 
 % @return An object containing the input.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterGlobalTypeInput', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(278), varargin{:});
 end
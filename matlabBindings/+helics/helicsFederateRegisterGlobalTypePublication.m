@@ -13,5 +13,5 @@ function varargout = helicsFederateRegisterGlobalTypePublication(varargin)
 % 
 % @return An object containing the publication.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterGlobalTypePublication', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(274), varargin{:});
 end
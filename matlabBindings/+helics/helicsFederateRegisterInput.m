@@ -13,5 +13,5 @@ function varargout = helicsFederateRegisterInput(varargin)
 % 
 % @return An object containing the input.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterInput', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(275), varargin{:});
 end
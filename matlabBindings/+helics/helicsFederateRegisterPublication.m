@@ -13,5 +13,5 @@ function varargout = helicsFederateRegisterPublication(varargin)
 % 
 % @return An object containing the publication.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterPublication', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(271), varargin{:});
 end
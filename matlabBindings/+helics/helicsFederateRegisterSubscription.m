@@ -12,5 +12,5 @@ function varargout = helicsFederateRegisterSubscription(varargin)
 % 
 % @return An object containing the input.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterSubscription', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(270), varargin{:});
 end
@@ -14,5 +14,5 @@ function varargout = helicsFederateRegisterTargetedEndpoint(varargin)
 % 
 % @return An object containing the endpoint, or nullptr on failure.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterTargetedEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(364), varargin{:});
 end
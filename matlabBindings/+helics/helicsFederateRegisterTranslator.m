@@ -12,5 +12,5 @@ function varargout = helicsFederateRegisterTranslator(varargin)
 % 
 % @return A HelicsTranslator object.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterTranslator', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(457), varargin{:});
 end
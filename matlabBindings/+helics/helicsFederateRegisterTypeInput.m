@@ -13,5 +13,5 @@ function varargout = helicsFederateRegisterTypeInput(varargin)
 % 
 % @return An object containing the publication.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterTypeInput', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(276), varargin{:});
 end
@@ -13,5 +13,5 @@ function varargout = helicsFederateRegisterTypePublication(varargin)
 % 
 % @return An object containing the publication.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRegisterTypePublication', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(272), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsFederateRequestNextStep(varargin)
 % 
 % @return The time granted to the federate, will return HELICS_TIME_MAXTIME if the simulation has terminated or is invalid
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRequestNextStep', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(213), varargin{:});
 end
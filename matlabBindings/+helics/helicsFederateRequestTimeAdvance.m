@@ -7,5 +7,5 @@ function varargout = helicsFederateRequestTimeAdvance(varargin)
 % 
 % @return The time granted to the federate, will return HELICS_TIME_MAXTIME if the simulation has terminated or is invalid
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRequestTimeAdvance', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(212), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsFederateRequestTimeAsync(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRequestTimeAsync', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(215), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsFederateRequestTimeComplete(varargin)
 % 
 % @return The time granted to the federate, will return HELICS_TIME_MAXTIME if the simulation has terminated.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRequestTimeComplete', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(216), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsFederateRequestTimeIterative(varargin)
 %	@param iterate The requested iteration mode.
 
 %	@return granted time and HelicsIterationResult.
-	[varargout{1:nargout}] = helicsMex('helicsFederateRequestTimeIterative', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(214), varargin{:});
 end
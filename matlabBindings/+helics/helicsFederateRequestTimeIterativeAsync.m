@@ -10,5 +10,5 @@ function varargout = helicsFederateRequestTimeIterativeAsync(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateRequestTimeIterativeAsync', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(217), varargin{:});
 end
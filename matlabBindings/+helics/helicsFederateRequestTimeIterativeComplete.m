@@ -4,5 +4,5 @@ function varargout = helicsFederateRequestTimeIterativeComplete(varargin)
 %	@param fed The federate to make the request of.
 
 %	@return tuple of HelicsTime and HelicsIterationResult.
-	[varargout{1:nargout}] = helicsMex('helicsFederateRequestTimeIterativeComplete', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(218), varargin{:});
 end
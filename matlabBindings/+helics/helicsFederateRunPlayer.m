@@ -0,0 +1,16 @@
+function varargout = helicsFederateRunPlayer(varargin)
+% Replay a table of values on a set of publications from a background thread.
+%
+% @details For each row the player requests the time and then publishes the row on the publications.
+%        The federate must not be used from MATLAB until the player has finished, callbacks it raises
+%        run while MATLAB waits in helicsPlayerWait or helicsMex('__pump').
+%
+% @param fed The federate to step, it must be in executing mode.
+% @param pubs A uint64 array of publications.
+% @param times The time of each step.
+% @param values A double matrix with one row per time and one column per publication.
+%
+% @return The id of the player.
+
+	[varargout{1:nargout}] = helicsMex(int32(520), varargin{:});
+end
@@ -8,5 +8,5 @@ function varargout = helicsFederateSetGlobal(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetGlobal', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(230), varargin{:});
 end
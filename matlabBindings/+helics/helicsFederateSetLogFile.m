@@ -6,5 +6,5 @@ function varargout = helicsFederateSetLogFile(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetLogFile', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(234), varargin{:});
 end
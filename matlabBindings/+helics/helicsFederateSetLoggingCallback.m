@@ -7,5 +7,5 @@ function varargout = helicsFederateSetLoggingCallback(varargin)
 
 %	@param fed The federate object in which to set the callback.
 %	@param logger A function handle with the signature void(int loglevel, string identifier, string message).
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetLoggingCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(480), varargin{:});
 end
@@ -0,0 +1,9 @@
+function varargout = helicsFederateSetMessagePool(varargin)
+% Set the size of the pool of reusable messages for a federate and fill it.
+%
+% @param fed The federate that creates the messages.
+% @param capacity The number of messages kept in the pool, 0 frees the pooled messages.
+% @param reserveSize Optional, the number of bytes reserved in each pooled message (default 0).
+
+	[varargout{1:nargout}] = helicsMex(int32(527), varargin{:});
+end
@@ -2,9 +2,11 @@ function varargout = helicsFederateSetQueryCallback(varargin)
 %	Set callback for queries executed against a federate.
 
 %	@details There are many queries that HELICS understands directly, but it is occasionally useful to a have a federate be able to respond
+%	The callback runs only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),
+%	HELICS waits for it for at most the time set with helicsCallbackSetTimeout and then handles the query as if the callback had left the buffer empty.
 %	tospecific queries with answers specific to a federate.
 
 %	@param fed The federate object in which to set the callback.
 %	@param queryAnswer A function handle with the signature const void(const char *query, int querySize, HelicsQueryBuffer buffer).
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetQueryCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(483), varargin{:});
 end
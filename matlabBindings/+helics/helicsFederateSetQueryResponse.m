@@ -0,0 +1,14 @@
+function varargout = helicsFederateSetQueryResponse(varargin)
+% Set the answer to a query of a federate, the query is answered without calling MATLAB.
+%
+% @details Queries without an answer go to the callback set with helicsFederateSetQueryCallback.
+%        Calling this again for the same query replaces the answer, which is a cheap way to keep
+%        a live value current.
+%
+% @param fed The federate to answer the query for.
+% @param query The query string to answer.
+% @param answer A string returned as it is, a double array returned as a JSON number or array
+%        formatted when queried, or empty to remove the answer.
+
+	[varargout{1:nargout}] = helicsMex(int32(516), varargin{:});
+end
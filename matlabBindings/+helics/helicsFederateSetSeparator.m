@@ -9,5 +9,5 @@ function varargout = helicsFederateSetSeparator(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetSeparator', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(223), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsFederateSetStateChangeCallback(varargin)
 
 %	@param fed The federate object in which to set the callback.
 %	@param stateChange A function handle with the signature void(int newState, int oldState).
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetStateChangeCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(486), varargin{:});
 end
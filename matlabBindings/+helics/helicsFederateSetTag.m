@@ -8,5 +8,5 @@ function varargout = helicsFederateSetTag(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(231), varargin{:});
 end
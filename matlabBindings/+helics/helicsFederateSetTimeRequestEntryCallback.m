@@ -5,5 +5,5 @@ function varargout = helicsFederateSetTimeRequestEntryCallback(varargin)
 
 %	@param fed The federate object in which to set the callback.
 %	@param requestTime A callback with the signature void(double currentTime, double requestTime, bool iterating).
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetTimeRequestEntryCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(484), varargin{:});
 end
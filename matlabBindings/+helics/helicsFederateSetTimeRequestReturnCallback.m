@@ -5,5 +5,5 @@ function varargout = helicsFederateSetTimeRequestReturnCallback(varargin)
 
 %	@param fed The federate object in which to set the callback.
 %	@param requestTimeReturn A callback with the signature void(double newTime, bool iterating).
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetTimeRequestReturnCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(487), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsFederateSetTimeUpdateCallback(varargin)
 
 %	@param fed The federate object in which to set the callback.
 %	@param timeUpdate A function handle with the signature void(double newTime, int iterating).
-	[varargout{1:nargout}] = helicsMex('helicsFederateSetTimeUpdateCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(485), varargin{:});
 end
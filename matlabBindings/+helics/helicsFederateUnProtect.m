@@ -9,5 +9,5 @@ function varargout = helicsFederateUnProtect(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if the federate was not found.
 
-	[varargout{1:nargout}] = helicsMex('helicsFederateUnProtect', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(159), varargin{:});
 end
@@ -0,0 +1,13 @@
+function varargout = helicsFederatesRequestTimeAll(varargin)
+% Request a time for several federates and wait until all of them have been granted a time.
+%
+% @details The requests are made at the same time so federates in the same process do not block
+%        each other, queued callbacks run while waiting.
+%
+% @param feds A uint64 array of federates.
+% @param times The requested time, a scalar for all federates or one time per federate.
+%
+% @return The granted times in an array of the same size as feds.
+
+	[varargout{1:nargout}] = helicsMex(int32(518), varargin{:});
+end
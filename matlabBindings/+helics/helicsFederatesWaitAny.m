@@ -0,0 +1,16 @@
+function varargout = helicsFederatesWaitAny(varargin)
+% Wait until at least one of several federates has completed a time request made with
+% helicsFederateRequestTimeAsync and complete the requests that are done.
+%
+% @details Queued callbacks run while waiting. Federates without an outstanding time request are
+%        skipped and it is an error if none has one. A request that is not done yet keeps completing in
+%        the background and is returned by a later call or by helicsFederateRequestTimeComplete.
+%
+% @param feds A uint64 array of federates with outstanding time requests.
+% @param timeout Optional, the longest time to wait in milliseconds (default wait forever).
+%
+% @return A column vector with the indices into feds of the completed requests, empty on timeout.
+% @return A column vector with the granted time of each completed request.
+
+	[varargout{1:nargout}] = helicsMex(int32(519), varargin{:});
+end
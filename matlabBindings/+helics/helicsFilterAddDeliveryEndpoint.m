@@ -8,5 +8,5 @@ function varargout = helicsFilterAddDeliveryEndpoint(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterAddDeliveryEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(448), varargin{:});
 end
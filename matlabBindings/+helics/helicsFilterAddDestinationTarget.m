@@ -7,5 +7,5 @@ function varargout = helicsFilterAddDestinationTarget(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterAddDestinationTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(446), varargin{:});
 end
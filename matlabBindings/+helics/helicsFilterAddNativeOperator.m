@@ -0,0 +1,23 @@
+function varargout = helicsFilterAddNativeOperator(varargin)
+% Add a built in message operator to a filter, the operator runs inside HELICS without calling MATLAB.
+%
+% @details Operators added to the same filter are applied in order, each call to this function
+%        installs the filter custom callback so it should be used on custom filters. The 'duplicate'
+%        operator adds delivery endpoints and raises an error unless the filter was registered as a
+%        cloning filter.
+%        Operators should be added before the federate enters executing mode.
+%
+% @param filt The filter to add the operator to.
+% @param name The name of the operator.
+%        'delay': delay messages by 'delay' seconds, or by 'delays' for the matching entry of 'destinations'.
+%        'bernoulliLoss': drop each message with 'probability'.
+%        'gilbertElliottLoss': burst loss with state change probabilities 'goodToBad' and 'badToGood'
+%            and loss probabilities 'lossGood' (default 0) and 'lossBad' (default 1).
+%        'tokenBucket': drop messages exceeding 'rate' bytes per second with a bucket of 'burst' bytes.
+%        'truncate': cut payloads to 'maxBytes' bytes.
+%        'reroute': replace destinations matching the regular expression 'pattern' with 'destination'.
+%        'duplicate': deliver copies to the endpoint or cell array of endpoints in 'destinations'.
+% @param params Optional, a struct with the operator parameters, the loss operators also accept a 'seed'.
+
+	[varargout{1:nargout}] = helicsMex(int32(507), varargin{:});
+end
@@ -8,5 +8,5 @@ function varargout = helicsFilterAddSourceTarget(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterAddSourceTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(447), varargin{:});
 end
@@ -0,0 +1,7 @@
+function varargout = helicsFilterClearNativeOperators(varargin)
+% Remove the built in message operators from a filter, messages then pass through unchanged.
+%
+% @param filt The filter to clear.
+
+	[varargout{1:nargout}] = helicsMex(int32(508), varargin{:});
+end
@@ -5,5 +5,5 @@ function varargout = helicsFilterGetInfo(varargin)
 % 
 % @return A string with the info field string.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterGetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(451), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsFilterGetName(varargin)
 % 
 % @return A string with the name of the filter.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterGetName', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(443), varargin{:});
 end
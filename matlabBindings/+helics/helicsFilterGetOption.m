@@ -4,5 +4,5 @@ function varargout = helicsFilterGetOption(varargin)
 % @param filt The given filter to query.
 % @param option The option to query /ref helics_handle_options.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterGetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(456), varargin{:});
 end
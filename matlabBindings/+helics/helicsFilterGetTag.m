@@ -5,5 +5,5 @@ function varargout = helicsFilterGetTag(varargin)
 % @param tagname The name of the tag to query.
 % @return A string with the tag data.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterGetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(453), varargin{:});
 end
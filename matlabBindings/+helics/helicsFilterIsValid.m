@@ -5,5 +5,5 @@ function varargout = helicsFilterIsValid(varargin)
 % 
 % @return HELICS_TRUE if the Filter object represents a valid filter.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(442), varargin{:});
 end
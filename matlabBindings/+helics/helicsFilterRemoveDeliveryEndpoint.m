@@ -6,5 +6,5 @@ function varargout = helicsFilterRemoveDeliveryEndpoint(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterRemoveDeliveryEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(450), varargin{:});
 end
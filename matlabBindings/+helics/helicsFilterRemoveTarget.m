@@ -7,5 +7,5 @@ function varargout = helicsFilterRemoveTarget(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterRemoveTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(449), varargin{:});
 end
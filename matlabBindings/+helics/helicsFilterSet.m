@@ -7,5 +7,5 @@ function varargout = helicsFilterSet(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterSet', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(444), varargin{:});
 end
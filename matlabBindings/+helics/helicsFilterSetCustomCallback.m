@@ -2,8 +2,10 @@ function varargout = helicsFilterSetCustomCallback(varargin)
 %	Set a general callback for a custom filter.
 
 %	@details Add a custom filter callback function for creating a custom filter operation in the c shared library.
+%	The callback runs only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),
+%	HELICS waits for it for at most the time set with helicsCallbackSetTimeout and then passes the message through unchanged.
 
 %	@param filter The filter object in which to set the callback.
 %	@param filtCall A function handle with the signature HelicsMessage(HelicsMessage message).
-	[varargout{1:nargout}] = helicsMex('helicsFilterSetCustomCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(481), varargin{:});
 end
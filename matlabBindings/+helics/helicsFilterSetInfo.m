@@ -6,5 +6,5 @@ function varargout = helicsFilterSetInfo(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterSetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(452), varargin{:});
 end
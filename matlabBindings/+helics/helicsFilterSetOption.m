@@ -7,5 +7,5 @@ function varargout = helicsFilterSetOption(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterSetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(455), varargin{:});
 end
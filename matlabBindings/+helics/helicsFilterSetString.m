@@ -7,5 +7,5 @@ function varargout = helicsFilterSetString(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterSetString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(445), varargin{:});
 end
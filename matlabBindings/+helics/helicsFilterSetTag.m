@@ -7,5 +7,5 @@ function varargout = helicsFilterSetTag(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsFilterSetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(454), varargin{:});
 end
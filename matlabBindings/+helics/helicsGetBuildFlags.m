@@ -1,5 +1,5 @@
 function varargout = helicsGetBuildFlags(varargin)
 % Get the build flags used to compile HELICS.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetBuildFlags', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(103), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsGetCompilerVersion(varargin)
 % Get the compiler version used to compile HELICS.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetCompilerVersion', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(104), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsGetDataType(varargin)
 % 
 % @return An int with the data type or HELICS_DATA_TYPE_UNKNOWN(-1) if not a valid value.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetDataType', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(180), varargin{:});
 end
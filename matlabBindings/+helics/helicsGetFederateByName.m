@@ -10,5 +10,5 @@ function varargout = helicsGetFederateByName(varargin)
 % 
 % @return NULL if no fed is available by that name otherwise a HelicsFederate with that name.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetFederateByName', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(142), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsGetFlagIndex(varargin)
 % @param val A string with the option name.
 % @return An int with the property code or (-1) if not a valid property.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetFlagIndex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(177), varargin{:});
 end
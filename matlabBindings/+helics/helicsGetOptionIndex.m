@@ -6,5 +6,5 @@ function varargout = helicsGetOptionIndex(varargin)
 % 
 % @return An int with the option index or (-1) if not a valid property.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetOptionIndex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(178), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsGetOptionValue(varargin)
 % 
 % @return An int with the option value or (-1) if not a valid value.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetOptionValue', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(179), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsGetPropertyIndex(varargin)
 % @param val A string with the property name.
 % @return An int with the property code or (-1) if not a valid property.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetPropertyIndex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(176), varargin{:});
 end
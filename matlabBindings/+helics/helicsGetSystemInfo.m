@@ -3,5 +3,5 @@ function varargout = helicsGetSystemInfo(varargin)
 % The string contains fields with system information like cpu, core count, operating system, and memory,
 % as well as information about the HELICS build.  Used for debugging reports and gathering other information.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetSystemInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(105), varargin{:});
 end
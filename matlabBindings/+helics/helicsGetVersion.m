@@ -1,5 +1,5 @@
 function varargout = helicsGetVersion(varargin)
 % Get a version string for HELICS.
 
-	[varargout{1:nargout}] = helicsMex('helicsGetVersion', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(102), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsInputAddTarget(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputAddTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(303), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsInputClearUpdate(varargin)
 % Clear the updated flag from an input.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputClearUpdate', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(359), varargin{:});
 end
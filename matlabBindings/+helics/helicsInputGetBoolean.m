@@ -6,5 +6,5 @@ function varargout = helicsInputGetBoolean(varargin)
 % 
 % @return A boolean value of current input value.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetBoolean', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(310), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsInputGetByteCount(varargin)
 % 
 % @return The size of the raw data/string in bytes.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetByteCount', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(304), varargin{:});
 end
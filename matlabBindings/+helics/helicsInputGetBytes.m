@@ -4,5 +4,5 @@ function varargout = helicsInputGetBytes(varargin)
 %	@param ipt The input to get the data for.
 
 %	@return  raw Bytes of the value, the value is uninterpreted raw bytes.
-	[varargout{1:nargout}] = helicsMex('helicsInputGetBytes', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(305), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsInputGetChar(varargin)
 % @return The resulting character value.
 %         NAK (negative acknowledgment) symbol returned on error
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetChar', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(313), varargin{:});
 end
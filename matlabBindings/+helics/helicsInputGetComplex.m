@@ -4,5 +4,5 @@ function varargout = helicsInputGetComplex(varargin)
 %	@param ipt The input to get the data for.
 
 %	@return  A complex number.
-	[varargout{1:nargout}] = helicsMex('helicsInputGetComplex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(315), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsInputGetComplexObject(varargin)
 %	@param ipt The input to get the data for.
 
 %	@return  A complex number.
-	[varargout{1:nargout}] = helicsMex('helicsInputGetComplexObject', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(314), varargin{:});
 end
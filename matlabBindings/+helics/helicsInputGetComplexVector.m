@@ -4,5 +4,5 @@ function varargout = helicsInputGetComplexVector(varargin)
 %	@param ipt The input to get the vector for.
 
 %	@return a list of complex values.
-	[varargout{1:nargout}] = helicsMex('helicsInputGetComplexVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(318), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsInputGetDataBuffer(varargin)
 % 
 % @return A HelicsDataBuffer object containing the data
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetDataBuffer', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(306), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsInputGetDouble(varargin)
 % 
 % @return The double value of the input.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetDouble', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(311), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsInputGetExtractionUnits(varargin)
 % 
 % @return A void enumeration, HELICS_OK if everything worked.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetExtractionUnits', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(341), varargin{:});
 end
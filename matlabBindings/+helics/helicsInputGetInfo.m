@@ -5,5 +5,5 @@ function varargout = helicsInputGetInfo(varargin)
 % 
 % @return A string with the info field string.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(343), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsInputGetInjectionUnits(varargin)
 % 
 % @return A void enumeration, HELICS_OK if everything worked.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetInjectionUnits', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(340), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsInputGetInteger(varargin)
 % 
 % @return An int64_t value with the current value of the input.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetInteger', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(309), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsInputGetName(varargin)
 % 
 % @return A const char with the input name.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetName', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(335), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsInputGetNamedPoint(varargin)
 %	@param ipt The input to get the result for.
 
 %	@return a string and a double value for the named point
-	[varargout{1:nargout}] = helicsMex('helicsInputGetNamedPoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(319), varargin{:});
 end
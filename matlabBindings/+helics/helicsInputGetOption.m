@@ -6,5 +6,5 @@ function varargout = helicsInputGetOption(varargin)
 % 
 % @return An integer value with the current value of the given option.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(351), varargin{:});
 end
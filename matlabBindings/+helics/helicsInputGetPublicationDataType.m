@@ -5,5 +5,5 @@ function varargout = helicsInputGetPublicationDataType(varargin)
 % 
 % @return An int containing the enumeration value of the publication type.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetPublicationDataType', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(333), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsInputGetPublicationType(varargin)
 % 
 % with the type name.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetPublicationType', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(332), varargin{:});
 end
@@ -0,0 +1,9 @@
+function varargout = helicsInputGetRawBytes(varargin)
+% Get the raw data for the latest value of a subscription as bytes.
+%
+% @param ipt The input to get the data for.
+%
+% @return A uint8 row vector with the uninterpreted bytes of the value.
+
+	[varargout{1:nargout}] = helicsMex(int32(502), varargin{:});
+end
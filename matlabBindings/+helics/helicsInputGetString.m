@@ -4,5 +4,5 @@ function varargout = helicsInputGetString(varargin)
 %	@param ipt The input to get the string for.
 
 %	@return the string value.
-	[varargout{1:nargout}] = helicsMex('helicsInputGetString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(308), varargin{:});
 end
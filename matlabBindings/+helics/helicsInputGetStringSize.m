@@ -3,5 +3,5 @@ function varargout = helicsInputGetStringSize(varargin)
 % 
 % @return The size of the string.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetStringSize', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(307), varargin{:});
 end
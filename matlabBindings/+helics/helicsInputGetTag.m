@@ -5,5 +5,5 @@ function varargout = helicsInputGetTag(varargin)
 % @param tagname The name of the tag to get the value for.
 % @return A string with the tag data.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(345), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsInputGetTarget(varargin)
 % 
 % @return A const char with the input target.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(337), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsInputGetTime(varargin)
 % 
 % @return The resulting time value.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetTime', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(312), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsInputGetType(varargin)
 % 
 % @return A void enumeration, HELICS_OK if everything worked.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetType', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(331), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsInputGetUnits(varargin)
 % 
 % @return A void enumeration, HELICS_OK if everything worked.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetUnits', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(339), varargin{:});
 end
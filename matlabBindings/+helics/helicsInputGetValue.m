@@ -0,0 +1,15 @@
+function varargout = helicsInputGetValue(varargin)
+% Get the value of an input converted to the data type of the publication it is connected to.
+%
+% @details The publication data type is looked up once per input and cached.
+%        double and time values are returned as a double, integers as an int64, booleans as a logical,
+%        complex values as a complex double, vectors as double or complex column vectors, named points
+%        as a struct with name and value fields, raw data as a uint8 array and anything else as a string.
+%
+% @param ipt The input to get the value for.
+%
+% @return The value of the input.
+% @return The HelicsDataTypes value used to convert the value.
+
+	[varargout{1:nargout}] = helicsMex(int32(505), varargin{:});
+end
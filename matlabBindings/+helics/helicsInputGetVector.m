@@ -4,5 +4,5 @@ function varargout = helicsInputGetVector(varargin)
 %	@param ipt The input to get the vector for.
 
 %	@return  a list of floating point values.
-	[varargout{1:nargout}] = helicsMex('helicsInputGetVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(317), varargin{:});
 end
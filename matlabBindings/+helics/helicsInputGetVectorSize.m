@@ -3,5 +3,5 @@ function varargout = helicsInputGetVectorSize(varargin)
 % 
 % @return The number of doubles in a returned vector.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputGetVectorSize', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(316), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsInputIsUpdated(varargin)
 % 
 % @return HELICS_TRUE if it has been updated since the last value retrieval.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputIsUpdated', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(357), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsInputIsValid(varargin)
 % 
 % @return HELICS_TRUE if the Input object represents a valid input.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(302), varargin{:});
 end
@@ -1,5 +1,5 @@
 function varargout = helicsInputLastUpdateTime(varargin)
 % Get the last time a input was updated.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputLastUpdateTime', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(358), varargin{:});
 end
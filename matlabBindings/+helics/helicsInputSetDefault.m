@@ -19,7 +19,7 @@ function  helicsInputSetDefault(varargin)
                end
            else
                if (numel(pubdata)>1)
-                   helicsInputSetDefaultVector(varargin{:});
+                   helicsInputSetDefaultComplexVector(varargin{:});
                else
                    helicsInputSetDefaultComplex(varargin{:});
                end
@@ -33,7 +33,7 @@ function  helicsInputSetDefault(varargin)
                end
            else
                if (numel(pubdata)>1)
-                   helicsInputSetDefaultVector(varargin{:});
+                   helicsInputSetDefaultComplexVector(varargin{1},double(pubdata));
                else
                    helicsInputSetDefaultComplex(varargin{1},double(pubdata));
                end
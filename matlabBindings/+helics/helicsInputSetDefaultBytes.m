@@ -3,5 +3,5 @@ function varargout = helicsInputSetDefaultBytes(varargin)
 
 %	@param ipt The input to set the default for.
 %	@param raw data to use for the default.
-	[varargout{1:nargout}] = helicsMex('helicsInputSetDefaultBytes', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(320), varargin{:});
 end
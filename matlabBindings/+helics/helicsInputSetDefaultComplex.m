@@ -3,5 +3,5 @@ function varargout = helicsInputSetDefaultComplex(varargin)
 
 %	@param ipt The input to get the data for.
 %	@param value The default complex value.
-	[varargout{1:nargout}] = helicsMex('helicsInputSetDefaultComplex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(327), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsInputSetDefaultComplexVector(varargin)
 
 %	@param ipt The input to get the data for.
 %	@param vectorInput The default list of complex values.
-	[varargout{1:nargout}] = helicsMex('helicsInputSetDefaultComplexVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(329), varargin{:});
 end
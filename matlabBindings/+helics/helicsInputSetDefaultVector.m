@@ -3,5 +3,5 @@ function varargout = helicsInputSetDefaultVector(varargin)
 
 %	@param ipt The input to get the data for.
 %	@param vectorInput The default list of floating point values.
-	[varargout{1:nargout}] = helicsMex('helicsInputSetDefaultVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(328), varargin{:});
 end
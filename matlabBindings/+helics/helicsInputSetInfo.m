@@ -6,5 +6,5 @@ function varargout = helicsInputSetInfo(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputSetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(344), varargin{:});
 end
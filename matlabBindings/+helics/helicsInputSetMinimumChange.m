@@ -6,5 +6,5 @@ function varargout = helicsInputSetMinimumChange(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputSetMinimumChange', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(356), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsInputSetOption(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputSetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(352), varargin{:});
 end
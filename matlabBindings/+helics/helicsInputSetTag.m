@@ -7,5 +7,5 @@ function varargout = helicsInputSetTag(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsInputSetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(346), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsIsCoreTypeAvailable(varargin)
 % 
 % @details Options include "zmq", "udp", "ipc", "interprocess", "tcp", "default", "mpi".
 
-	[varargout{1:nargout}] = helicsMex('helicsIsCoreTypeAvailable', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(114), varargin{:});
 end
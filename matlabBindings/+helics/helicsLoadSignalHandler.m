@@ -2,5 +2,5 @@ function varargout = helicsLoadSignalHandler(varargin)
 % Load a signal handler that handles Ctrl-C and shuts down all HELICS brokers, cores,
 % and federates then exits the process.
 
-	[varargout{1:nargout}] = helicsMex('helicsLoadSignalHandler', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(108), varargin{:});
 end
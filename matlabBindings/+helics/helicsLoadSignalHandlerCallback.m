@@ -1,3 +1,3 @@
 function varargout = helicsLoadSignalHandlerCallback(varargin)
-	[varargout{1:nargout}] = helicsMex('helicsLoadSignalHandlerCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(111), varargin{:});
 end
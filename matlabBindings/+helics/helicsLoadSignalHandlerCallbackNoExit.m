@@ -1,3 +1,3 @@
 function varargout = helicsLoadSignalHandlerCallbackNoExit(varargin)
-	[varargout{1:nargout}] = helicsMex('helicsLoadSignalHandlerCallbackNoExit', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(112), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsLoadThreadedSignalHandler(varargin)
 % and federates then exits the process.  This operation will execute in a newly created and detached thread returning control back to the
 % calling program before completing operations.
 
-	[varargout{1:nargout}] = helicsMex('helicsLoadThreadedSignalHandler', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(109), varargin{:});
 end
@@ -0,0 +1,11 @@
+function varargout = helicsLoggingBufferDrain(varargin)
+% Remove the oldest messages from the logging buffer of a federate, core or broker.
+%
+% @param obj The federate, core or broker the buffer was set for.
+% @param maxCount Optional, the largest number of messages to return (default all).
+%
+% @return A struct array with level, identifier and message fields, use struct2table for a table.
+% @return The number of messages dropped because the buffer was full since the last drain.
+
+	[varargout{1:nargout}] = helicsMex(int32(513), varargin{:});
+end
@@ -3,5 +3,5 @@ function varargout = helicsMessageAppendData(varargin)
 
 %	@param message The message object in question.
 %	@param data A string containing the message data to append.
-	[varargout{1:nargout}] = helicsMex('helicsMessageAppendData', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(428), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsMessageClear(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageClear', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(432), varargin{:});
 end
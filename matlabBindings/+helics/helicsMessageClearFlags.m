@@ -3,5 +3,5 @@ function varargout = helicsMessageClearFlags(varargin)
 % 
 % @param message The message object in question
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageClearFlags', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(423), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsMessageClone(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageClone', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(430), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsMessageCopy(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageCopy', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(429), varargin{:});
 end
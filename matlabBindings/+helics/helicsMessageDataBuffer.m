@@ -5,5 +5,5 @@ function varargout = helicsMessageDataBuffer(varargin)
 % 
 % @return A HelicsDataBuffer object to the data in a message.  Modifying the buffer will directly modify the message contents.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageDataBuffer', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(413), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsMessageFree(varargin)
 % to the system that the memory for this message is done being used and can be reused for a new message.
 % helicsFederateClearMessages() can also be used to clear up all stored messages at once
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageFree', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(431), varargin{:});
 end
@@ -0,0 +1,11 @@
+function varargout = helicsMessageFromStruct(varargin)
+% Create messages with their fields and payload set from a struct array in a single call.
+%
+% @param fed The federate that creates the messages.
+% @param s A struct array with any of the fields returned by helicsMessageToStruct, missing or empty fields keep
+%        their default value.
+%
+% @return An array of HelicsMessage of the same size as s.
+
+	[varargout{1:nargout}] = helicsMex(int32(533), varargin{:});
+end
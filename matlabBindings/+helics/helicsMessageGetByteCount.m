@@ -5,5 +5,5 @@ function varargout = helicsMessageGetByteCount(varargin)
 % 
 % @return The size of the data payload.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetByteCount', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(410), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsMessageGetBytes(varargin)
 %	@param message A message object to get the data for.
 
 %	@return Raw string data.
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetBytes', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(411), varargin{:});
 end
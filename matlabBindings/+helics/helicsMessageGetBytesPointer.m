@@ -2,8 +2,10 @@ function varargout = helicsMessageGetBytesPointer(varargin)
 % Get a pointer to the raw data of a message.
 % 
 % @param message A message object to get the data for.
+% @param asArray Optional, true to return the payload itself as a uint8 row vector filled with a single copy
+%        instead of its address (default false).
 % 
 % @return A pointer to the raw data in memory, the pointer may be NULL if the message is not a valid message.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetBytesPointer', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(412), varargin{:});
 end
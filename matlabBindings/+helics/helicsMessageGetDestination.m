@@ -5,5 +5,5 @@ function varargout = helicsMessageGetDestination(varargin)
 % 
 % @return A string with the destination endpoint.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetDestination', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(403), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsMessageGetFlagOption(varargin)
 % 
 % @return The flags associated with a message.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetFlagOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(409), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsMessageGetMessageID(varargin)
 % 
 % @return The messageID.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetMessageID', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(408), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsMessageGetOriginalDestination(varargin)
 % 
 % @return A string with the original destination of a message.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetOriginalDestination', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(405), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsMessageGetOriginalSource(varargin)
 % 
 % @return A string with the source of a message.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetOriginalSource', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(404), varargin{:});
 end
@@ -0,0 +1,9 @@
+function varargout = helicsMessageGetRawBytes(varargin)
+% Get the raw data for a message object as bytes.
+%
+% @param message A message object to get the data for.
+%
+% @return A uint8 row vector with the message payload.
+
+	[varargout{1:nargout}] = helicsMex(int32(503), varargin{:});
+end
@@ -5,5 +5,5 @@ function varargout = helicsMessageGetSource(varargin)
 % 
 % @return A string with the source endpoint.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetSource', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(402), varargin{:});
 end
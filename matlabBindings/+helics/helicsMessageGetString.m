@@ -5,5 +5,5 @@ function varargout = helicsMessageGetString(varargin)
 % 
 % @return A string representing the payload of a message.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(407), varargin{:});
 end
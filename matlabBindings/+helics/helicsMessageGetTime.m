@@ -5,5 +5,5 @@ function varargout = helicsMessageGetTime(varargin)
 % 
 % @return The time associated with a message.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageGetTime', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(406), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsMessageIsValid(varargin)
 % 
 % @return HELICS_TRUE if the message contains a payload.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(414), varargin{:});
 end
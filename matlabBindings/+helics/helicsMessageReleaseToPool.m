@@ -0,0 +1,7 @@
+function varargout = helicsMessageReleaseToPool(varargin)
+% Clear a message and return it to the pool it came from without sending it.
+%
+% @param message A message from helicsFederateGetPooledMessage.
+
+	[varargout{1:nargout}] = helicsMex(int32(530), varargin{:});
+end
@@ -8,5 +8,5 @@ function varargout = helicsMessageReserve(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageReserve', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(421), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsMessageResize(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageResize', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(420), varargin{:});
 end
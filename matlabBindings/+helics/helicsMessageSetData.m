@@ -3,5 +3,5 @@ function varargout = helicsMessageSetData(varargin)
 
 %	@param message The message object in question.
 %	@param data A string containing the message data.
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetData', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(426), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsMessageSetDataBuffer(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetDataBuffer', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(427), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsMessageSetDestination(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetDestination', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(416), varargin{:});
 end
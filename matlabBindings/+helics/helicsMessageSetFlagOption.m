@@ -7,5 +7,5 @@ function varargout = helicsMessageSetFlagOption(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetFlagOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(424), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsMessageSetMessageID(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetMessageID', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(422), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsMessageSetOriginalDestination(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetOriginalDestination', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(418), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsMessageSetOriginalSource(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetOriginalSource', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(417), varargin{:});
 end
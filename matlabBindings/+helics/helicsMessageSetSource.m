@@ -6,5 +6,5 @@ function varargout = helicsMessageSetSource(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetSource', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(415), varargin{:});
 end
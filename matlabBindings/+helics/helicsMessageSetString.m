@@ -6,5 +6,5 @@ function varargout = helicsMessageSetString(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(425), varargin{:});
 end
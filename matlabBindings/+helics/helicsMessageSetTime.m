@@ -6,5 +6,5 @@ function varargout = helicsMessageSetTime(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsMessageSetTime', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(419), varargin{:});
 end
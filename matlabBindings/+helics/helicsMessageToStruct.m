@@ -0,0 +1,11 @@
+function varargout = helicsMessageToStruct(varargin)
+% Get every field and the payload of one or more messages in a single call.
+%
+% @param message A HelicsMessage or an array of them.
+%
+% @return A struct array of the same size with the fields source, destination, originalSource, originalDestination,
+%         time, messageID, flags and data. flags is a uint16 whose bit k is flag k of the message and data is a
+%         uint8 row vector.
+
+	[varargout{1:nargout}] = helicsMex(int32(532), varargin{:});
+end
@@ -0,0 +1,10 @@
+function varargout = helicsPlayerGetStatus(varargin)
+% Get the progress of a player.
+%
+% @param id The id returned by helicsFederateRunPlayer.
+%
+% @return A struct with running, step (the number of steps published), time (the last granted time)
+%        and error fields.
+
+	[varargout{1:nargout}] = helicsMex(int32(522), varargin{:});
+end
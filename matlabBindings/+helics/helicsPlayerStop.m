@@ -0,0 +1,7 @@
+function varargout = helicsPlayerStop(varargin)
+% Ask a player to stop before its next time request.
+%
+% @param id The id returned by helicsFederateRunPlayer.
+
+	[varargout{1:nargout}] = helicsMex(int32(521), varargin{:});
+end
@@ -0,0 +1,12 @@
+function varargout = helicsPlayerWait(varargin)
+% Wait for a player to finish, running queued callbacks while waiting.
+%
+% @details A finished player is released and its id is no longer valid after this call.
+%
+% @param id The id returned by helicsFederateRunPlayer.
+% @param timeout Optional, the longest time to wait in milliseconds (default wait until finished).
+%
+% @return The status of the player as returned by helicsPlayerGetStatus.
+
+	[varargout{1:nargout}] = helicsMex(int32(523), varargin{:});
+end
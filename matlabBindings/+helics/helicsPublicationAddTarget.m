@@ -6,5 +6,5 @@ function varargout = helicsPublicationAddTarget(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationAddTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(301), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsPublicationGetInfo(varargin)
 % 
 % @return A string with the info field string.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationGetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(347), varargin{:});
 end
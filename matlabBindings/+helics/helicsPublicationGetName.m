@@ -7,5 +7,5 @@ function varargout = helicsPublicationGetName(varargin)
 % 
 % @return A const char with the publication name.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationGetName', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(338), varargin{:});
 end
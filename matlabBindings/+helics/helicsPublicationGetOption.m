@@ -6,5 +6,5 @@ function varargout = helicsPublicationGetOption(varargin)
 % 
 % @return A string with the info field string.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationGetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(353), varargin{:});
 end
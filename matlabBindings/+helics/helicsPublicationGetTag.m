@@ -5,5 +5,5 @@ function varargout = helicsPublicationGetTag(varargin)
 % @param tagname The name of the tag to query.
 % @return A string with the tag data.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationGetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(349), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsPublicationGetType(varargin)
 % 
 % @return A void enumeration, HELICS_OK if everything worked.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationGetType', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(334), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsPublicationGetUnits(varargin)
 % 
 % @return A void enumeration, HELICS_OK if everything worked.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationGetUnits', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(342), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsPublicationIsValid(varargin)
 % 
 % @return HELICS_TRUE if the publication is a valid publication.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(288), varargin{:});
 end
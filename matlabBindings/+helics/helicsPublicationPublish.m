@@ -1,52 +1,14 @@
-function  helicsPublicationPublish(varargin)
-    pubdata=varargin{2};
-    import helics.*
-   switch (class(pubdata))
-       case {'char'}
-           if (length(pubdata)==1)
-               helicsPublicationPublishChar(varargin{:});
-           else
-               helicsPublicationPublishString(varargin{:});
-           end
-       case {'int8'}
-           helicsPublicationPublishChar(varargin{:});
-       case {'double'}
-           if (isreal(pubdata))
-               if (numel(pubdata)>1)
-                   helicsPublicationPublishVector(varargin{:});
-               else
-                   helicsPublicationPublishDouble(varargin{:});
-               end
-           else
-               if (numel(pubdata)>1)
-                   helicsPublicationPublishVector(varargin{:});
-               else
-                   helicsPublicationPublishComplex(varargin{:});
-               end
-           end
-       case {'single'}
-           if (isreal(pubdata))
-                if (numel(pubdata)>1)
-                   helicsPublicationPublishVector(varargin{1},double(pubdata));
-               else
-                   helicsPublicationPublishDouble(varargin{1}, double(pubdata));
-               end
-           else
-               if (numel(pubdata)>1)
-                   helicsPublicationPublishVector(varargin{:});
-               else
-                   helicsPublicationPublishComplex(varargin{1},double(pubdata));
-               end
-           end
-       case {'int32','uint64','uint32','int16','uint16'}
-           helicsPublicationPublishInteger(varargin{1},int64(pubdata));
-       case {'int64'}
-           helicsPublicationPublishInteger(varargin{:});
-       case {'logical'}
-           if (pubdata)
-               helicsPublicationPublishBoolean(varargin{1},int32(1));
-           else
-               helicsPublicationPublishBoolean(varargin{1},int32(0));
-           end
-   end
+function varargout = helicsPublicationPublish(varargin)
+% Publish a value through HELICS, the publish function is picked from the type of the value.
+%
+% @param pub The publication to publish the value on.
+% @param value The value to publish.
+%        char: a single character as a char, otherwise a string.
+%        double/single: a scalar as a double, otherwise a vector; complex values as a complex or complex vector.
+%        logical: a scalar as a boolean, otherwise a vector.
+%        int8: a scalar as a char, otherwise a vector.
+%        other integer types: a scalar as an integer, otherwise a vector.
+%        cell: {name, value} as a named point, a cell array of strings as a JSON array string.
+
+	[varargout{1:nargout}] = helicsMex(int32(504), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsPublicationPublishBoolean(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishBoolean', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(292), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsPublicationPublishBytes(varargin)
 
 %	@param pub The publication to publish for.
 %	@param data the raw byte data to publish.
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishBytes', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(289), varargin{:});
 end
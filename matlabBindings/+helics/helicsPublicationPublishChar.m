@@ -6,5 +6,5 @@ function varargout = helicsPublicationPublishChar(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishChar', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(295), varargin{:});
 end
@@ -3,5 +3,5 @@ function varargout = helicsPublicationPublishComplex(varargin)
 
 %	@param pub The publication to publish for.
 %	@param value The complex number.
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishComplex', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(296), varargin{:});
 end
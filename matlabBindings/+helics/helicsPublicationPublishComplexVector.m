@@ -3,5 +3,5 @@ function varargout = helicsPublicationPublishComplexVector(varargin)
 
 %	@param pub The publication to publish for.
 %	@param vectorInput The list of complex values.
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishComplexVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(298), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsPublicationPublishDataBuffer(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishDataBuffer', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(300), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsPublicationPublishDouble(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishDouble', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(293), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsPublicationPublishInteger(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishInteger', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(291), varargin{:});
 end
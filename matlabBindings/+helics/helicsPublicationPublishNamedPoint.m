@@ -7,5 +7,5 @@ function varargout = helicsPublicationPublishNamedPoint(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishNamedPoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(299), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsPublicationPublishString(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(290), varargin{:});
 end
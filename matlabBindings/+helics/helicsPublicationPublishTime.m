@@ -6,5 +6,5 @@ function varargout = helicsPublicationPublishTime(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishTime', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(294), varargin{:});
 end
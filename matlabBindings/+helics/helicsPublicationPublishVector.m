@@ -3,5 +3,5 @@ function varargout = helicsPublicationPublishVector(varargin)
 
 %	@param pub The publication to publish for.
 %	@param vectorInput The list of floating point values.
-	[varargout{1:nargout}] = helicsMex('helicsPublicationPublishVector', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(297), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsPublicationSetInfo(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationSetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(348), varargin{:});
 end
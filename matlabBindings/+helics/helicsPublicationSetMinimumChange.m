@@ -6,5 +6,5 @@ function varargout = helicsPublicationSetMinimumChange(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationSetMinimumChange', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(355), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsPublicationSetOption(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationSetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(354), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsPublicationSetTag(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsPublicationSetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(350), varargin{:});
 end
@@ -11,5 +11,5 @@ function varargout = helicsQueryBrokerExecute(varargin)
 % The return will be nullptr if broker or query is an invalid object, the return string will be "#invalid" if the query itself was
 % invalid
 
-	[varargout{1:nargout}] = helicsMex('helicsQueryBrokerExecute', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(261), varargin{:});
 end
@@ -5,5 +5,5 @@ function varargout = helicsQueryBufferFill(varargin)
 
 %	@param buffer The buffer received in a helicsQueryCallback.
 %	@param queryResult The string with the data to fill the buffer with.
-	[varargout{1:nargout}] = helicsMex('helicsQueryBufferFill', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(495), varargin{:});
 end
@@ -11,5 +11,5 @@ function varargout = helicsQueryCoreExecute(varargin)
 % The return will be nullptr if core or query is an invalid object, the return string will be "#invalid" if the query itself was
 % invalid.
 
-	[varargout{1:nargout}] = helicsMex('helicsQueryCoreExecute', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(260), varargin{:});
 end
@@ -12,5 +12,5 @@ function varargout = helicsQueryExecute(varargin)
 % The return will be nullptr if fed or query is an invalid object, the return string will be "#invalid" if the query itself was
 % invalid.
 
-	[varargout{1:nargout}] = helicsMex('helicsQueryExecute', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(259), varargin{:});
 end
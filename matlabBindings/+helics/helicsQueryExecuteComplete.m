@@ -10,5 +10,5 @@ function varargout = helicsQueryExecuteComplete(varargin)
 % @return A pointer to a string. The string will remain valid until the query is freed or executed again.
 % The return will be nullptr if query is an invalid object
 
-	[varargout{1:nargout}] = helicsMex('helicsQueryExecuteComplete', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(263), varargin{:});
 end
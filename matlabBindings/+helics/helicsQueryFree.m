@@ -1,5 +1,5 @@
 function varargout = helicsQueryFree(varargin)
 % Free the memory associated with a query object.
 
-	[varargout{1:nargout}] = helicsMex('helicsQueryFree', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(268), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsQueryIsCompleted(varargin)
 % @return Will return HELICS_TRUE if an asynchronous query has completed or a regular query call was made with a result,
 % and false if an asynchronous query has not completed or is invalid
 
-	[varargout{1:nargout}] = helicsMex('helicsQueryIsCompleted', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(264), varargin{:});
 end
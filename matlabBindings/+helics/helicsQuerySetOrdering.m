@@ -7,5 +7,5 @@ function varargout = helicsQuerySetOrdering(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsQuerySetOrdering', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(267), varargin{:});
 end
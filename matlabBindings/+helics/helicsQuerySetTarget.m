@@ -7,5 +7,5 @@ function varargout = helicsQuerySetTarget(varargin)
 % 
 % @param[in,out] err An error object that will contain an error code and string if any error occurred during the execution of the function.
 
-	[varargout{1:nargout}] = helicsMex('helicsQuerySetTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(265), varargin{:});
 end
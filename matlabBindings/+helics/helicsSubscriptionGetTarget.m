@@ -3,5 +3,5 @@ function varargout = helicsSubscriptionGetTarget(varargin)
 % 
 % @return A const char with the subscription target.
 
-	[varargout{1:nargout}] = helicsMex('helicsSubscriptionGetTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(336), varargin{:});
 end
@@ -9,5 +9,5 @@ function varargout = helicsTranslatorAddDestinationEndpoint(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorAddDestinationEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(470), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsTranslatorAddInputTarget(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorAddInputTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(467), varargin{:});
 end
@@ -10,5 +10,5 @@ function varargout = helicsTranslatorAddPublicationTarget(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorAddPublicationTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(468), varargin{:});
 end
@@ -8,5 +8,5 @@ function varargout = helicsTranslatorAddSourceEndpoint(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorAddSourceEndpoint', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(469), varargin{:});
 end
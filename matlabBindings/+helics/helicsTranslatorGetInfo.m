@@ -5,5 +5,5 @@ function varargout = helicsTranslatorGetInfo(varargin)
 % 
 % @return A string with the info field string.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorGetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(472), varargin{:});
 end
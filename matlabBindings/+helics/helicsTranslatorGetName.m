@@ -5,5 +5,5 @@ function varargout = helicsTranslatorGetName(varargin)
 % 
 % @return A string with the name of the translator.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorGetName', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(464), varargin{:});
 end
@@ -4,5 +4,5 @@ function varargout = helicsTranslatorGetOption(varargin)
 % @param trans The given translator to query.
 % @param option The option to query /ref helics_handle_options.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorGetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(477), varargin{:});
 end
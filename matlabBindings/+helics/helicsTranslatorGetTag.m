@@ -5,5 +5,5 @@ function varargout = helicsTranslatorGetTag(varargin)
 % @param tagname The name of the tag to query.
 % @return A string with the tag data.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorGetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(474), varargin{:});
 end
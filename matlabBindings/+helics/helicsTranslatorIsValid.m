@@ -5,5 +5,5 @@ function varargout = helicsTranslatorIsValid(varargin)
 % 
 % @return HELICS_TRUE if the Translator object represents a valid translator.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorIsValid', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(463), varargin{:});
 end
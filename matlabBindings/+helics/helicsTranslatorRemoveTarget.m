@@ -7,5 +7,5 @@ function varargout = helicsTranslatorRemoveTarget(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorRemoveTarget', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(471), varargin{:});
 end
@@ -7,5 +7,5 @@ function varargout = helicsTranslatorSet(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorSet', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(465), varargin{:});
 end
@@ -1,8 +1,10 @@
 function varargout = helicsTranslatorSetCustomCallback(varargin)
 %	Set a general callback for a custom Translator.n
 %	@details Add a pair of custom callbacks for running a translator operation in the C shared library.
+%	The callbacks run only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),
+%	HELICS waits for them for at most the time set with helicsCallbackSetTimeout and then leaves the output unchanged.
 %	@param translator The translator object to set the callbacks for.
 %	@param toMessageCall A callback with the signature void(HelicsDataBuffer, HelicsMessage).
 %	@param toValueCall A callback with the signature void(HelicsMessage, HelicsDataBuffer).
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorSetCustomCallback', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(482), varargin{:});
 end
@@ -6,5 +6,5 @@ function varargout = helicsTranslatorSetInfo(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorSetInfo', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(473), varargin{:});
 end
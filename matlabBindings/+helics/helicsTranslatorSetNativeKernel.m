@@ -0,0 +1,17 @@
+function varargout = helicsTranslatorSetNativeKernel(varargin)
+% Set a built in conversion kernel for a translator, the conversion runs inside HELICS without calling MATLAB.
+%
+% @details This replaces a callback set with helicsTranslatorSetCustomCallback, which remains available
+%        for conversions that need MATLAB code.
+%
+% @param trans The translator to set the kernel for.
+% @param name The name of the kernel.
+%        'doubleJson': a double value and a {"key":value} JSON message, parameter 'key' (default 'value').
+%        'vectorCsv': a vector value and a separated list, parameter 'separator' (default ',').
+%        'namedPointKeyValue': a named point and a name=value message, parameter 'separator' (default '=').
+%        'binaryPack': a vector value and a fixed binary layout, parameter 'layout' with one of the
+%            field types d, f, q, Q, i, I, h, H, b, B per element and an optional < or > byte order prefix.
+% @param params Optional, a struct with the kernel parameters.
+
+	[varargout{1:nargout}] = helicsMex(int32(509), varargin{:});
+end
@@ -7,5 +7,5 @@ function varargout = helicsTranslatorSetOption(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorSetOption', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(476), varargin{:});
 end
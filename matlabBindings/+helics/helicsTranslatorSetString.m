@@ -7,5 +7,5 @@ function varargout = helicsTranslatorSetString(varargin)
 % 
 % @param[in,out] err A pointer to an error object for catching errors.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorSetString', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(466), varargin{:});
 end
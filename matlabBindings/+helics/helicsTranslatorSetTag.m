@@ -7,5 +7,5 @@ function varargout = helicsTranslatorSetTag(varargin)
 % 
 % @param[in,out] err An error object to fill out in case of an error.
 
-	[varargout{1:nargout}] = helicsMex('helicsTranslatorSetTag', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(475), varargin{:});
 end
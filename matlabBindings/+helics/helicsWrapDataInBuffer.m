@@ -1,5 +1,5 @@
 function varargout = helicsWrapDataInBuffer(varargin)
 % wrap user data in a buffer object
 
-	[varargout{1:nargout}] = helicsMex('helicsWrapDataInBuffer', varargin{:});
+	[varargout{1:nargout}] = helicsMex(int32(67), varargin{:});
 end
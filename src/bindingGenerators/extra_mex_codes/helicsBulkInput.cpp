@@ -0,0 +1,67 @@
+void _wrap_helicsFederateGetInputDoubles(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 2 || argc > 3){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetInputDoubles:rhs","This function requires at least 2 arguments and at most 3 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetInputDoubles:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+	if(helicsFederateIsValid(fed) != HELICS_TRUE){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("helics:invalid_object","The given federate object is not valid.");
+	}
+
+	if(mxGetClassID(argv[1]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetInputDoubles:TypeError","Argument 2 must be an array of type uint64.");
+	}
+	size_t inputCount = mxGetNumberOfElements(argv[1]);
+	HelicsInput *inputs = static_cast<HelicsInput*>(mxGetData(argv[1]));
+
+	bool clearUpdates = false;
+	if(argc > 2){
+		double flag = -1.0;
+		if((mxIsLogical(argv[2]) || mxIsNumeric(argv[2])) && !mxIsComplex(argv[2]) && mxGetNumberOfElements(argv[2]) == 1){
+			flag = mxGetScalar(argv[2]);
+		}
+		if(flag != 0.0 && flag != 1.0){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetInputDoubles:TypeError","Argument 3 must be a logical type or a 0 or 1.");
+		}
+		clearUpdates = (flag == 1.0);
+	}
+
+	mxArray *_out = mxCreateDoubleMatrix(inputCount, 1, mxREAL);
+	mxDouble *values = mxGetDoubles(_out);
+	mxArray *_out1 = mxCreateLogicalMatrix(inputCount, 1);
+	mxLogical *updated = mxGetLogicals(_out1);
+
+	HelicsError err = helicsErrorInitialize();
+
+	for(size_t ii = 0; ii < inputCount && err.error_code == HELICS_OK; ++ii){
+		/* the update flag has to be sampled before the read */
+		updated[ii] = (helicsInputIsUpdated(inputs[ii]) == HELICS_TRUE);
+		values[ii] = helicsInputGetDouble(inputs[ii], &err);
+		if(clearUpdates){
+			helicsInputClearUpdate(inputs[ii]);
+		}
+	}
+
+	if(err.error_code != HELICS_OK){
+		mxDestroyArray(_out);
+		mxDestroyArray(_out1);
+		throwHelicsMatlabError(&err);
+	}
+
+	resv[0] = _out;
+	if(resc > 1){
+		resv[1] = _out1;
+	}else{
+		mxDestroyArray(_out1);
+	}
+}
+
+
@@ -0,0 +1,153 @@
+/* common argument checks for the helicsFederatePublish* functions, returns the number of publications */
+static size_t checkBulkPublishArguments(const char *functionName, int argc, const mxArray *argv[]){
+	std::string errorId = std::string("MATLAB:") + functionName;
+	if(argc != 3){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt((errorId + ":rhs").c_str(),"This function requires 3 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt((errorId + ":TypeError").c_str(),"Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+	if(helicsFederateIsValid(fed) != HELICS_TRUE){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("helics:invalid_object","The given federate object is not valid.");
+	}
+
+	if(mxGetClassID(argv[1]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt((errorId + ":TypeError").c_str(),"Argument 2 must be an array of type uint64.");
+	}
+	return mxGetNumberOfElements(argv[1]);
+}
+
+/* the column of a value matrix or the element of a value cell array that belongs to publication index */
+static const mxArray *getBulkPublishCell(const char *functionName, const mxArray *values, size_t index){
+	const mxArray *value = mxGetCell(values, index);
+	if(value == nullptr || !mxIsDouble(value)){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt((std::string("MATLAB:") + functionName + ":TypeError").c_str(),"Each cell of argument 3 must be an array of type double.");
+	}
+	return value;
+}
+
+void _wrap_helicsFederatePublishDoubles(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	size_t pubCount = checkBulkPublishArguments("helicsFederatePublishDoubles", argc, argv);
+	HelicsPublication *pubs = static_cast<HelicsPublication*>(mxGetData(argv[1]));
+
+	if(!mxIsDouble(argv[2]) || mxIsComplex(argv[2]) || mxGetNumberOfElements(argv[2]) != pubCount){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatePublishDoubles:TypeError","Argument 3 must be a real double array with one value per publication.");
+	}
+	const mxDouble *values = mxGetDoubles(argv[2]);
+
+	HelicsError err = helicsErrorInitialize();
+
+	for(size_t ii = 0; ii < pubCount && err.error_code == HELICS_OK; ++ii){
+		helicsPublicationPublishDouble(pubs[ii], values[ii], &err);
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsFederatePublishComplexes(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	size_t pubCount = checkBulkPublishArguments("helicsFederatePublishComplexes", argc, argv);
+	HelicsPublication *pubs = static_cast<HelicsPublication*>(mxGetData(argv[1]));
+
+	if(!mxIsDouble(argv[2]) || mxGetNumberOfElements(argv[2]) != pubCount){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatePublishComplexes:TypeError","Argument 3 must be a double array with one value per publication.");
+	}
+
+	HelicsError err = helicsErrorInitialize();
+
+	if(mxIsComplex(argv[2])){
+		const mxComplexDouble *values = mxGetComplexDoubles(argv[2]);
+		for(size_t ii = 0; ii < pubCount && err.error_code == HELICS_OK; ++ii){
+			helicsPublicationPublishComplex(pubs[ii], values[ii].real, values[ii].imag, &err);
+		}
+	}else{
+		const mxDouble *values = mxGetDoubles(argv[2]);
+		for(size_t ii = 0; ii < pubCount && err.error_code == HELICS_OK; ++ii){
+			helicsPublicationPublishComplex(pubs[ii], values[ii], 0.0, &err);
+		}
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsFederatePublishVectors(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	size_t pubCount = checkBulkPublishArguments("helicsFederatePublishVectors", argc, argv);
+	HelicsPublication *pubs = static_cast<HelicsPublication*>(mxGetData(argv[1]));
+
+	HelicsError err = helicsErrorInitialize();
+
+	if(mxIsCell(argv[2])){
+		if(mxGetNumberOfElements(argv[2]) != pubCount){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatePublishVectors:TypeError","Argument 3 must have one cell per publication.");
+		}
+		for(size_t ii = 0; ii < pubCount && err.error_code == HELICS_OK; ++ii){
+			const mxArray *value = getBulkPublishCell("helicsFederatePublishVectors", argv[2], ii);
+			helicsPublicationPublishVector(pubs[ii], mxGetDoubles(value), static_cast<int>(mxGetNumberOfElements(value)), &err);
+		}
+	}else{
+		if(!mxIsDouble(argv[2]) || mxIsComplex(argv[2]) || mxGetN(argv[2]) != pubCount){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatePublishVectors:TypeError","Argument 3 must be a cell array or a real double matrix with one column per publication.");
+		}
+		size_t vectorLength = mxGetM(argv[2]);
+		const mxDouble *values = mxGetDoubles(argv[2]);
+		for(size_t ii = 0; ii < pubCount && err.error_code == HELICS_OK; ++ii){
+			helicsPublicationPublishVector(pubs[ii], values + ii * vectorLength, static_cast<int>(vectorLength), &err);
+		}
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsFederatePublishComplexVectors(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	size_t pubCount = checkBulkPublishArguments("helicsFederatePublishComplexVectors", argc, argv);
+	HelicsPublication *pubs = static_cast<HelicsPublication*>(mxGetData(argv[1]));
+
+	HelicsError err = helicsErrorInitialize();
+
+	if(mxIsCell(argv[2])){
+		if(mxGetNumberOfElements(argv[2]) != pubCount){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatePublishComplexVectors:TypeError","Argument 3 must have one cell per publication.");
+		}
+		for(size_t ii = 0; ii < pubCount && err.error_code == HELICS_OK; ++ii){
+			const mxArray *value = getBulkPublishCell("helicsFederatePublishComplexVectors", argv[2], ii);
+			helicsPublicationPublishComplexVector(pubs[ii], getInterleavedComplexData(value), static_cast<int>(mxGetNumberOfElements(value) * 2), &err);
+		}
+	}else{
+		if(!mxIsDouble(argv[2]) || mxGetN(argv[2]) != pubCount){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatePublishComplexVectors:TypeError","Argument 3 must be a cell array or a double matrix with one column per publication.");
+		}
+		size_t vectorLength = mxGetM(argv[2]);
+		/* complex storage is passed through, a real matrix is interleaved with zero imaginary parts once for all columns */
+		const double *values = getInterleavedComplexData(argv[2]);
+		for(size_t ii = 0; ii < pubCount && err.error_code == HELICS_OK; ++ii){
+			helicsPublicationPublishComplexVector(pubs[ii], values + ii * vectorLength * 2, static_cast<int>(vectorLength * 2), &err);
+		}
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
@@ -0,0 +1,26 @@
+void _wrap_helicsMexPump(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc > 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:__pump:rhs","This function requires at most 1 arguments.");
+	}
+
+	int timeout = 0;
+	if(argc > 0){
+		if(!mxIsNumeric(argv[0]) || mxGetNumberOfElements(argv[0]) != 1){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:__pump:TypeError","Argument 1 must be a scalar timeout in milliseconds.");
+		}
+		timeout = static_cast<int>(mxGetScalar(argv[0]));
+	}
+
+	/* with a timeout wait for the first callback if nothing is queued yet */
+	int count = pumpCallbackEvents();
+	if(count == 0 && timeout > 0){
+		callbackQueue.waitForEvents(std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout));
+		count = pumpCallbackEvents();
+	}
+
+	resv[0] = mxCreateDoubleScalar(static_cast<double>(count));
+}
+
+
@@ -0,0 +1,92 @@
+void _wrap_helicsCallbackRemove(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsCallbackRemove:rhs","This function requires 1 arguments.");
+	}
+
+	if(!mxIsNumeric(argv[0]) || mxGetNumberOfElements(argv[0]) != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsCallbackRemove:TypeError","Argument 1 must be a scalar callback id.");
+	}
+	helicsMexCallback *callback = findMatlabCallback(static_cast<int>(mxGetScalar(argv[0])));
+	if(callback == nullptr){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsCallbackRemove:TypeError","Argument 1 is not the id of a callback that is set.");
+	}
+
+	HelicsError err = helicsErrorInitialize();
+
+	removeMatlabCallback(callback, &err);
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsCallbackGetStatistics(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc > 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsCallbackGetStatistics:rhs","This function requires at most 1 arguments.");
+	}
+
+	int id = 0;
+	if(argc > 0){
+		if(!mxIsNumeric(argv[0]) || mxGetNumberOfElements(argv[0]) != 1){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsCallbackGetStatistics:TypeError","Argument 1 must be a scalar callback id.");
+		}
+		id = static_cast<int>(mxGetScalar(argv[0]));
+		if(findMatlabCallback(id) == nullptr){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsCallbackGetStatistics:TypeError","Argument 1 is not the id of a callback that is set.");
+		}
+	}
+
+	/* one entry per function handle, a translator has two with the same id */
+	std::vector<helicsMexCallback *> callbacks;
+	for(helicsMexCallback *slot : matlabCallbacks){
+		if(slot->rhs[0] == nullptr || (id != 0 && slot->id != id)){
+			continue;
+		}
+		for(helicsMexCallback *part = slot; part != nullptr; part = part->next){
+			callbacks.push_back(part);
+		}
+	}
+
+	const char *fields[] = {"id", "setter", "callback", "calls", "totalSeconds", "maxSeconds", "meanSeconds", "timeouts"};
+	mxArray *_out = mxCreateStructMatrix(callbacks.size(), 1, 8, fields);
+	for(size_t ii = 0; ii < callbacks.size(); ++ii){
+		helicsMexCallback *callback = callbacks[ii];
+		mxSetFieldByNumber(_out, ii, 0, mxCreateDoubleScalar(static_cast<double>(callback->id)));
+		mxSetFieldByNumber(_out, ii, 1, mxCreateString(callback->setter));
+		mxSetFieldByNumber(_out, ii, 2, mxDuplicateArray(callback->rhs[0]));
+		mxSetFieldByNumber(_out, ii, 3, mxCreateDoubleScalar(callback->calls));
+		mxSetFieldByNumber(_out, ii, 4, mxCreateDoubleScalar(callback->totalSeconds));
+		mxSetFieldByNumber(_out, ii, 5, mxCreateDoubleScalar(callback->maxSeconds));
+		mxSetFieldByNumber(_out, ii, 6, mxCreateDoubleScalar(callback->calls > 0.0 ? callback->totalSeconds / callback->calls : 0.0));
+		mxSetFieldByNumber(_out, ii, 7, mxCreateDoubleScalar(static_cast<double>(callback->timeouts.load())));
+	}
+
+	resv[0] = _out;
+}
+
+
+void _wrap_helicsCallbackSetTimeout(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsCallbackSetTimeout:rhs","This function requires 1 arguments.");
+	}
+
+	if(!mxIsNumeric(argv[0]) || mxGetNumberOfElements(argv[0]) != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsCallbackSetTimeout:TypeError","Argument 1 must be a scalar timeout in milliseconds.");
+	}
+	double timeout = mxGetScalar(argv[0]);
+
+	/* negative, infinite and out of range timeouts all wait forever */
+	bool forever = !(timeout >= 0.0 && timeout <= static_cast<double>(std::numeric_limits<int>::max()));
+	callbackReturnTimeout.store(forever ? -1 : static_cast<int>(timeout));
+}
+
+
@@ -0,0 +1,95 @@
+/* the destination of message index or nullptr for the default destination, copied into the arena so the send loop does not allocate */
+static const char *getSendManyDestination(const mxArray *destinations, size_t index){
+	const mxArray *destination = mxIsCell(destinations) ? mxGetCell(destinations, index) : destinations;
+	if(destination == nullptr || mxIsEmpty(destination)){
+		return nullptr;
+	}
+	if(!mxIsChar(destination)){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendMany:TypeError","Each cell of argument 3 must be a string.");
+	}
+	size_t dstLength = mxGetNumberOfElements(destination) + 1;
+	char *dst = static_cast<char *>(marshalArena.allocate(dstLength));
+	mxGetString(destination, dst, dstLength);
+	return dst;
+}
+
+void _wrap_helicsEndpointSendMany(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 2 || argc > 4){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendMany:rhs","This function requires at least 2 arguments and at most 4 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendMany:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsEndpoint endpoint = *(static_cast<HelicsEndpoint*>(mxGetData(argv[0])));
+
+	if(!mxIsCell(argv[1])){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendMany:TypeError","Argument 2 must be a cell array of strings or uint8 arrays.");
+	}
+	size_t count = mxGetNumberOfElements(argv[1]);
+	for(size_t ii = 0; ii < count; ++ii){
+		const mxArray *payload = mxGetCell(argv[1], ii);
+		if(payload != nullptr && !mxIsChar(payload) && !mxIsUint8(payload)){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendMany:TypeError","Each cell of argument 2 must be a string or an array of type uint8.");
+		}
+	}
+
+	/* a single string or empty destination applies to every message, empty uses the default destination */
+	const mxArray *destinations = (argc > 2) ? argv[2] : nullptr;
+	bool perMessageDestination = destinations != nullptr && mxIsCell(destinations);
+	if(destinations != nullptr && !mxIsEmpty(destinations) && !mxIsChar(destinations) && !perMessageDestination){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendMany:TypeError","Argument 3 must be a string or a cell array of strings.");
+	}
+	if(perMessageDestination && mxGetNumberOfElements(destinations) != count){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendMany:TypeError","Argument 3 must have one destination per payload.");
+	}
+	const char *commonDestination = (destinations != nullptr && !perMessageDestination) ? getSendManyDestination(destinations, 0) : nullptr;
+
+	/* a scalar time applies to every message, no time or an empty time sends at the current time */
+	const mxDouble *times = nullptr;
+	size_t timeCount = 0;
+	if(argc > 3 && !mxIsEmpty(argv[3])){
+		timeCount = mxGetNumberOfElements(argv[3]);
+		if(!mxIsDouble(argv[3]) || mxIsComplex(argv[3]) || (timeCount != 1 && timeCount != count)){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendMany:TypeError","Argument 4 must be a double scalar or have one time per payload.");
+		}
+		times = mxGetDoubles(argv[3]);
+	}
+
+	HelicsError err = helicsErrorInitialize();
+
+	for(size_t ii = 0; ii < count && err.error_code == HELICS_OK; ++ii){
+		const mxArray *payload = mxGetCell(argv[1], ii);
+		int dataLength = 0;
+		const void *data = (payload != nullptr) ? getBytePayload(payload, &dataLength) : nullptr;
+		const char *dst = perMessageDestination ? getSendManyDestination(destinations, ii) : commonDestination;
+		if(times != nullptr){
+			HelicsTime time = times[(timeCount == 1) ? 0 : ii];
+			if(dst != nullptr){
+				helicsEndpointSendBytesToAt(endpoint, data, dataLength, dst, time, &err);
+			}else{
+				helicsEndpointSendBytesAt(endpoint, data, dataLength, time, &err);
+			}
+		}else{
+			if(dst != nullptr){
+				helicsEndpointSendBytesTo(endpoint, data, dataLength, dst, &err);
+			}else{
+				helicsEndpointSendBytes(endpoint, data, dataLength, &err);
+			}
+		}
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
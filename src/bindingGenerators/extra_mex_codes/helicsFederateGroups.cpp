@@ -0,0 +1,210 @@
+/* a helicsFederateRequestTimeAsync request completed on a helper thread for helicsFederatesWaitAny,
+   kept until helicsFederatesWaitAny or helicsFederateRequestTimeComplete returns its result */
+struct helicsMexTimeCompletion {
+	HelicsTime granted = HELICS_TIME_INVALID;
+	HelicsError err = helicsErrorInitialize();
+	std::atomic<bool> done{false};
+};
+
+static std::unordered_map<HelicsFederate, std::shared_ptr<helicsMexTimeCompletion>> timeCompletions;
+
+/* hand over the result of the helper completing the time request of a federate, returns false if there is no helper */
+static bool takeTimeCompletion(HelicsFederate fed, HelicsTime *granted, HelicsError *err){
+	auto completion = timeCompletions.find(fed);
+	if(completion == timeCompletions.end()){
+		return false;
+	}
+	std::shared_ptr<helicsMexTimeCompletion> pending = completion->second;
+	waitPumpingCallbacks([&](){ return pending->done.load(); });
+	/* a callback run while waiting may have taken it already */
+	completion = timeCompletions.find(fed);
+	if(completion != timeCompletions.end() && completion->second == pending){
+		timeCompletions.erase(completion);
+	}
+	*granted = pending->granted;
+	*err = pending->err;
+	return true;
+}
+
+/* called once a federate has been freed, a null federate forgets every helper */
+static void forgetTimeCompletion(HelicsFederate fed){
+	if(fed == nullptr){
+		timeCompletions.clear();
+	}else{
+		timeCompletions.erase(fed);
+	}
+}
+
+static const HelicsFederate *getFederateArray(const char *functionName, const mxArray *feds, size_t *count){
+	if(mxGetClassID(feds) != mxUINT64_CLASS || mxIsEmpty(feds)){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt((std::string("MATLAB:") + functionName + ":TypeError").c_str(),"Argument 1 must be a non empty uint64 array of federates.");
+	}
+	*count = mxGetNumberOfElements(feds);
+	return static_cast<const HelicsFederate *>(mxGetData(feds));
+}
+
+void _wrap_helicsFederatesRequestTimeAll(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatesRequestTimeAll:rhs","This function requires 2 arguments.");
+	}
+
+	size_t count = 0;
+	const HelicsFederate *feds = getFederateArray("helicsFederatesRequestTimeAll", argv[0], &count);
+
+	size_t timeCount = mxGetNumberOfElements(argv[1]);
+	if(!mxIsDouble(argv[1]) || mxIsComplex(argv[1]) || (timeCount != 1 && timeCount != count)){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatesRequestTimeAll:TypeError","Argument 2 must be a double scalar or have one time per federate.");
+	}
+	const double *times = mxGetDoubles(argv[1]);
+
+	/* every request has to be made at once on the helper thread of its federate, so a federate may only be given once and
+	   must not have a helper still completing a request from helicsFederateRequestTimeAsync */
+	std::unordered_set<HelicsFederate> distinct(feds, feds + count);
+	if(distinct.size() != count){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatesRequestTimeAll:TypeError","Argument 1 must not contain the same federate more than once.");
+	}
+	for(size_t ii = 0; ii < count; ++ii){
+		if(timeCompletions.count(feds[ii]) != 0){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("helics:invalid_function_call","A federate has a time request from helicsFederateRequestTimeAsync outstanding.");
+		}
+	}
+
+	/* each request blocks in HELICS on the helper thread of its federate, each helper wakes the MATLAB thread when it returns */
+	std::vector<HelicsTime> granted(count, HELICS_TIME_INVALID);
+	std::vector<HelicsError> errors(count, helicsErrorInitialize());
+	std::vector<std::shared_ptr<helicsMexHelperThread>> helpers(count);
+	for(size_t ii = 0; ii < count; ++ii){
+		HelicsFederate fed = feds[ii];
+		HelicsTime requestTime = times[(timeCount == 1) ? 0 : ii];
+		waitForHelperThread(fed);
+		helpers[ii] = getHelperThread(fed);
+		helpers[ii]->start([&granted, &errors, ii, fed, requestTime](){
+			granted[ii] = helicsFederateRequestTime(fed, requestTime, &errors[ii]);
+		});
+	}
+	waitPumpingCallbacks([&](){
+		for(const std::shared_ptr<helicsMexHelperThread> &helper : helpers){
+			if(!helper->idle()){
+				return false;
+			}
+		}
+		return true;
+	});
+
+	mxArray *_out = mxCreateNumericArray(mxGetNumberOfDimensions(argv[0]), mxGetDimensions(argv[0]), mxDOUBLE_CLASS, mxREAL);
+	std::copy(granted.begin(), granted.end(), mxGetDoubles(_out));
+	resv[0] = _out;
+
+	for(HelicsError &err : errors){
+		if(err.error_code != HELICS_OK){
+			throwHelicsMatlabError(&err);
+		}
+	}
+}
+
+
+void _wrap_helicsFederatesWaitAny(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 1 || argc > 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatesWaitAny:rhs","This function requires at least 1 arguments and at most 2 arguments.");
+	}
+
+	size_t count = 0;
+	const HelicsFederate *feds = getFederateArray("helicsFederatesWaitAny", argv[0], &count);
+
+	double timeout = -1.0;
+	if(argc > 1){
+		if(!mxIsNumeric(argv[1]) || mxGetNumberOfElements(argv[1]) != 1){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsFederatesWaitAny:TypeError","Argument 2 must be a scalar timeout in milliseconds.");
+		}
+		timeout = mxGetScalar(argv[1]);
+	}
+
+	/* HELICS has no completion notification for async requests, so the helper thread of each federate with a pending time
+	   request blocks in helicsFederateRequestTimeComplete and wakes the MATLAB thread when it returns */
+	std::vector<std::shared_ptr<helicsMexTimeCompletion>> pending(count);
+	bool anyPending = false;
+	HelicsError err = helicsErrorInitialize();
+	for(size_t ii = 0; ii < count; ++ii){
+		HelicsFederate fed = feds[ii];
+		auto completion = timeCompletions.find(fed);
+		if(completion != timeCompletions.end()){
+			pending[ii] = completion->second;
+			anyPending = true;
+			continue;
+		}
+		HelicsFederateState state = helicsFederateGetState(fed, &err);
+		if(err.error_code != HELICS_OK){
+			throwHelicsMatlabError(&err);
+		}
+		if(state != HELICS_STATE_PENDING_TIME){
+			continue;
+		}
+		std::shared_ptr<helicsMexTimeCompletion> started = std::make_shared<helicsMexTimeCompletion>();
+		waitForHelperThread(fed);
+		getHelperThread(fed)->start([started, fed](){
+			started->granted = helicsFederateRequestTimeComplete(fed, &started->err);
+			started->done.store(true);
+		});
+		timeCompletions[fed] = started;
+		pending[ii] = started;
+		anyPending = true;
+	}
+	if(!anyPending){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("helics:invalid_function_call","None of the federates has a time request from helicsFederateRequestTimeAsync outstanding.");
+	}
+
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+	if(timeout >= 0.0){
+		deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(static_cast<long long>(timeout * 1000.0));
+	}
+	waitPumpingCallbacks([&](){
+		for(const std::shared_ptr<helicsMexTimeCompletion> &completion : pending){
+			if(completion != nullptr && completion->done.load()){
+				return true;
+			}
+		}
+		return false;
+	}, deadline);
+
+	std::vector<size_t> completed;
+	for(size_t ii = 0; ii < count; ++ii){
+		if(pending[ii] != nullptr && pending[ii]->done.load()){
+			completed.push_back(ii);
+			auto completion = timeCompletions.find(feds[ii]);
+			if(completion != timeCompletions.end() && completion->second == pending[ii]){
+				timeCompletions.erase(completion);
+			}
+		}
+	}
+	for(size_t index : completed){
+		if(pending[index]->err.error_code != HELICS_OK){
+			throwHelicsMatlabError(&pending[index]->err);
+		}
+	}
+
+	mxArray *indices = mxCreateDoubleMatrix(completed.size(), 1, mxREAL);
+	mxArray *granted = mxCreateDoubleMatrix(completed.size(), 1, mxREAL);
+	double *pIndices = mxGetDoubles(indices);
+	double *pGranted = mxGetDoubles(granted);
+	for(size_t ii = 0; ii < completed.size(); ++ii){
+		pIndices[ii] = static_cast<double>(completed[ii] + 1);
+		pGranted[ii] = pending[completed[ii]]->granted;
+	}
+
+	resv[0] = indices;
+	if(resc > 1){
+		resv[1] = granted;
+	}else{
+		mxDestroyArray(granted);
+	}
+}
+
+
@@ -0,0 +1,368 @@
+/* message operator run natively by a filter on a HELICS thread, it must not use the MATLAB API */
+class nativeFilterOperator {
+public:
+	virtual ~nativeFilterOperator() = default;
+	/* returns false if the message should be dropped */
+	virtual bool process(HelicsMessage message) = 0;
+};
+
+/* delays messages by a fixed amount, with per destination overrides */
+class delayFilterOperator : public nativeFilterOperator {
+public:
+	delayFilterOperator(double delay, std::unordered_map<std::string, double> destinationDelays) : defaultDelay(delay), delays(std::move(destinationDelays)) {}
+
+	bool process(HelicsMessage message) override {
+		double delay = defaultDelay;
+		if(!delays.empty()){
+			auto destinationDelay = delays.find(helicsMessageGetDestination(message));
+			if(destinationDelay != delays.end()){
+				delay = destinationDelay->second;
+			}
+		}
+		if(delay != 0.0){
+			helicsMessageSetTime(message, helicsMessageGetTime(message) + delay, nullptr);
+		}
+		return true;
+	}
+
+private:
+	double defaultDelay;
+	std::unordered_map<std::string, double> delays;
+};
+
+/* drops each message independently with a fixed probability */
+class bernoulliLossFilterOperator : public nativeFilterOperator {
+public:
+	bernoulliLossFilterOperator(double probability, std::mt19937_64::result_type seed) : generator(seed), loss(probability) {}
+
+	bool process(HelicsMessage message) override {
+		return !loss(generator);
+	}
+
+private:
+	std::mt19937_64 generator;
+	std::bernoulli_distribution loss;
+};
+
+/* two state burst loss model, the state changes before each message */
+class gilbertElliottLossFilterOperator : public nativeFilterOperator {
+public:
+	gilbertElliottLossFilterOperator(double goodToBad, double badToGood, double lossGood, double lossBad, std::mt19937_64::result_type seed) :
+		generator(seed), toBad(goodToBad), toGood(badToGood), lossInGood(lossGood), lossInBad(lossBad) {}
+
+	bool process(HelicsMessage message) override {
+		badState = badState ? !toGood(generator) : toBad(generator);
+		return badState ? !lossInBad(generator) : !lossInGood(generator);
+	}
+
+private:
+	std::mt19937_64 generator;
+	std::bernoulli_distribution toBad;
+	std::bernoulli_distribution toGood;
+	std::bernoulli_distribution lossInGood;
+	std::bernoulli_distribution lossInBad;
+	bool badState = false;
+};
+
+/* drops messages that exceed a byte rate, tokens refill with the message time */
+class tokenBucketFilterOperator : public nativeFilterOperator {
+public:
+	tokenBucketFilterOperator(double bytesPerSecond, double burstBytes) : rate(bytesPerSecond), burst(burstBytes), tokens(burstBytes) {}
+
+	bool process(HelicsMessage message) override {
+		double messageTime = helicsMessageGetTime(message);
+		if(messageTime > lastTime){
+			if(lastTime != HELICS_TIME_INVALID){
+				tokens = std::min(burst, tokens + (messageTime - lastTime) * rate);
+			}
+			lastTime = messageTime;
+		}
+		double size = static_cast<double>(helicsMessageGetByteCount(message));
+		if(size > tokens){
+			return false;
+		}
+		tokens -= size;
+		return true;
+	}
+
+private:
+	double rate;
+	double burst;
+	double tokens;
+	double lastTime = HELICS_TIME_INVALID;
+};
+
+/* cuts payloads down to a maximum size */
+class truncateFilterOperator : public nativeFilterOperator {
+public:
+	explicit truncateFilterOperator(int maxBytes) : maxSize(maxBytes) {}
+
+	bool process(HelicsMessage message) override {
+		if(helicsMessageGetByteCount(message) > maxSize){
+			helicsMessageResize(message, maxSize, nullptr);
+		}
+		return true;
+	}
+
+private:
+	int maxSize;
+};
+
+/* changes the destination of messages whose destination matches a regular expression */
+class rerouteFilterOperator : public nativeFilterOperator {
+public:
+	rerouteFilterOperator(const std::string &pattern, std::string replacement) : destinationPattern(pattern), newDestination(std::move(replacement)) {}
+
+	bool process(HelicsMessage message) override {
+		const char *destination = helicsMessageGetDestination(message);
+		if(std::regex_search(destination, destinationPattern)){
+			std::string rerouted = std::regex_replace(destination, destinationPattern, newDestination);
+			helicsMessageSetDestination(message, rerouted.c_str(), nullptr);
+		}
+		return true;
+	}
+
+private:
+	std::regex destinationPattern;
+	std::string newDestination;
+};
+
+/* the operators attached to one filter, applied in the order they were added */
+struct nativeFilterOperatorChain {
+	std::mutex lock;
+	std::vector<std::unique_ptr<nativeFilterOperator>> operators;
+};
+
+/* the chain of each filter operators were added to */
+static std::unordered_map<HelicsFilter, std::unique_ptr<nativeFilterOperatorChain>> nativeFilterOperatorChains;
+/* chains of freed filters, HELICS may still hold a pointer to them until the filter is gone,
+   so they are kept empty and only freed when the mex file unloads */
+static std::vector<std::unique_ptr<nativeFilterOperatorChain>> retiredFilterOperatorChains;
+
+/* called once the federate or core of a filter has been freed, a null filter retires every chain */
+static void retireFilterOperators(HelicsFilter filt){
+	for(auto chain = nativeFilterOperatorChains.begin(); chain != nativeFilterOperatorChains.end();){
+		if(filt != nullptr && chain->first != filt){
+			++chain;
+			continue;
+		}
+		{
+			std::lock_guard<std::mutex> lock(chain->second->lock);
+			chain->second->operators.clear();
+		}
+		retiredFilterOperatorChains.push_back(std::move(chain->second));
+		chain = nativeFilterOperatorChains.erase(chain);
+	}
+}
+
+static HelicsMessage nativeFilterOperatorCallback(HelicsMessage message, void *userData){
+	nativeFilterOperatorChain *chain = static_cast<nativeFilterOperatorChain *>(userData);
+	std::lock_guard<std::mutex> lock(chain->lock);
+	for(auto &filterOperator : chain->operators){
+		if(!filterOperator->process(message)){
+			/* returning no message drops it */
+			return nullptr;
+		}
+	}
+	return message;
+}
+
+static void nativeFilterOperatorError(const std::string &operatorName, const std::string &message){
+	mexUnlock();
+	helicsMexErrMsgIdAndTxt("MATLAB:helicsFilterAddNativeOperator:TypeError", ("The '" + operatorName + "' operator " + message).c_str());
+}
+
+static const mxArray *getNativeFilterOperatorField(const mxArray *params, const char *field){
+	return (params != nullptr) ? mxGetField(params, 0, field) : nullptr;
+}
+
+static double getNativeFilterOperatorNumber(const std::string &operatorName, const mxArray *params, const char *field, bool required, double defaultValue = 0.0){
+	const mxArray *value = getNativeFilterOperatorField(params, field);
+	if(value == nullptr){
+		if(required){
+			nativeFilterOperatorError(operatorName, std::string("requires a '") + field + "' parameter.");
+		}
+		return defaultValue;
+	}
+	if(!mxIsNumeric(value) || mxIsComplex(value) || mxGetNumberOfElements(value) != 1){
+		nativeFilterOperatorError(operatorName, std::string("parameter '") + field + "' must be a real scalar.");
+	}
+	return mxGetScalar(value);
+}
+
+static double getNativeFilterOperatorProbability(const std::string &operatorName, const mxArray *params, const char *field, bool required, double defaultValue = 0.0){
+	double probability = getNativeFilterOperatorNumber(operatorName, params, field, required, defaultValue);
+	if(probability < 0.0 || probability > 1.0){
+		nativeFilterOperatorError(operatorName, std::string("parameter '") + field + "' must be between 0 and 1.");
+	}
+	return probability;
+}
+
+static std::string getNativeFilterOperatorString(const std::string &operatorName, const mxArray *value, const char *field){
+	if(value == nullptr || !mxIsChar(value)){
+		nativeFilterOperatorError(operatorName, std::string("requires a string '") + field + "' parameter.");
+	}
+	char *str = mxArrayToUTF8String(value);
+	std::string result(str);
+	mxFree(str);
+	return result;
+}
+
+/* a string or a cell array of strings */
+static std::vector<std::string> getNativeFilterOperatorStrings(const std::string &operatorName, const mxArray *params, const char *field){
+	const mxArray *value = getNativeFilterOperatorField(params, field);
+	std::vector<std::string> result;
+	if(value != nullptr && mxIsCell(value)){
+		for(size_t ii = 0; ii < mxGetNumberOfElements(value); ++ii){
+			result.push_back(getNativeFilterOperatorString(operatorName, mxGetCell(value, ii), field));
+		}
+	}else{
+		result.push_back(getNativeFilterOperatorString(operatorName, value, field));
+	}
+	return result;
+}
+
+static std::mt19937_64::result_type getNativeFilterOperatorSeed(const std::string &operatorName, const mxArray *params){
+	if(getNativeFilterOperatorField(params, "seed") == nullptr){
+		return std::random_device{}();
+	}
+	return static_cast<std::mt19937_64::result_type>(getNativeFilterOperatorNumber(operatorName, params, "seed", true));
+}
+
+static std::unique_ptr<nativeFilterOperator> createNativeFilterOperator(const std::string &operatorName, const mxArray *params){
+	if(operatorName == "delay"){
+		std::unordered_map<std::string, double> destinationDelays;
+		if(getNativeFilterOperatorField(params, "destinations") != nullptr){
+			std::vector<std::string> destinations = getNativeFilterOperatorStrings(operatorName, params, "destinations");
+			const mxArray *delays = getNativeFilterOperatorField(params, "delays");
+			if(delays == nullptr || !mxIsDouble(delays) || mxIsComplex(delays) || mxGetNumberOfElements(delays) != destinations.size()){
+				nativeFilterOperatorError(operatorName, "requires a 'delays' parameter with one delay per destination.");
+			}
+			for(size_t ii = 0; ii < destinations.size(); ++ii){
+				destinationDelays[destinations[ii]] = mxGetDoubles(delays)[ii];
+			}
+		}
+		double delay = getNativeFilterOperatorNumber(operatorName, params, "delay", false);
+		return std::unique_ptr<nativeFilterOperator>(new delayFilterOperator(delay, std::move(destinationDelays)));
+	}
+	if(operatorName == "bernoulliLoss"){
+		double probability = getNativeFilterOperatorProbability(operatorName, params, "probability", true);
+		return std::unique_ptr<nativeFilterOperator>(new bernoulliLossFilterOperator(probability, getNativeFilterOperatorSeed(operatorName, params)));
+	}
+	if(operatorName == "gilbertElliottLoss"){
+		double goodToBad = getNativeFilterOperatorProbability(operatorName, params, "goodToBad", true);
+		double badToGood = getNativeFilterOperatorProbability(operatorName, params, "badToGood", true);
+		double lossGood = getNativeFilterOperatorProbability(operatorName, params, "lossGood", false, 0.0);
+		double lossBad = getNativeFilterOperatorProbability(operatorName, params, "lossBad", false, 1.0);
+		return std::unique_ptr<nativeFilterOperator>(new gilbertElliottLossFilterOperator(goodToBad, badToGood, lossGood, lossBad, getNativeFilterOperatorSeed(operatorName, params)));
+	}
+	if(operatorName == "tokenBucket"){
+		double rate = getNativeFilterOperatorNumber(operatorName, params, "rate", true);
+		double burst = getNativeFilterOperatorNumber(operatorName, params, "burst", true);
+		if(rate <= 0.0 || burst < 0.0){
+			nativeFilterOperatorError(operatorName, "requires a positive 'rate' and a non negative 'burst'.");
+		}
+		return std::unique_ptr<nativeFilterOperator>(new tokenBucketFilterOperator(rate, burst));
+	}
+	if(operatorName == "truncate"){
+		double maxBytes = getNativeFilterOperatorNumber(operatorName, params, "maxBytes", true);
+		if(maxBytes < 0.0){
+			nativeFilterOperatorError(operatorName, "parameter 'maxBytes' must not be negative.");
+		}
+		return std::unique_ptr<nativeFilterOperator>(new truncateFilterOperator(static_cast<int>(maxBytes)));
+	}
+	if(operatorName == "reroute"){
+		std::string pattern = getNativeFilterOperatorString(operatorName, getNativeFilterOperatorField(params, "pattern"), "pattern");
+		std::string destination = getNativeFilterOperatorString(operatorName, getNativeFilterOperatorField(params, "destination"), "destination");
+		try {
+			return std::unique_ptr<nativeFilterOperator>(new rerouteFilterOperator(pattern, destination));
+		}
+		catch(const std::regex_error &){
+			nativeFilterOperatorError(operatorName, "parameter 'pattern' is not a valid regular expression.");
+		}
+	}
+	mexUnlock();
+	helicsMexErrMsgIdAndTxt("MATLAB:helicsFilterAddNativeOperator:TypeError", ("Unknown filter operator '" + operatorName + "'.").c_str());
+	return nullptr;
+}
+
+void _wrap_helicsFilterAddNativeOperator(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 2 || argc > 3){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFilterAddNativeOperator:rhs","This function requires at least 2 arguments and at most 3 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFilterAddNativeOperator:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFilter filt = *(static_cast<HelicsFilter*>(mxGetData(argv[0])));
+
+	if(!mxIsChar(argv[1])){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFilterAddNativeOperator:TypeError","Argument 2 must be a string.");
+	}
+	char *name = mxArrayToUTF8String(argv[1]);
+	std::string operatorName(name);
+	mxFree(name);
+
+	const mxArray *params = nullptr;
+	if(argc > 2 && !mxIsEmpty(argv[2])){
+		if(!mxIsStruct(argv[2]) || mxGetNumberOfElements(argv[2]) != 1){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsFilterAddNativeOperator:TypeError","Argument 3 must be a scalar struct of operator parameters.");
+		}
+		params = argv[2];
+	}
+
+	HelicsError err = helicsErrorInitialize();
+
+	if(operatorName == "duplicate"){
+		/* copies are made by HELICS itself, a custom filter would silently ignore the delivery endpoints */
+		if(cloningFilters.count(filt) == 0){
+			nativeFilterOperatorError(operatorName, "requires a filter registered as a cloning filter.");
+		}
+		for(const std::string &destination : getNativeFilterOperatorStrings(operatorName, params, "destinations")){
+			helicsFilterAddDeliveryEndpoint(filt, destination.c_str(), &err);
+		}
+	}else{
+		std::unique_ptr<nativeFilterOperator> filterOperator = createNativeFilterOperator(operatorName, params);
+		auto chain = nativeFilterOperatorChains.find(filt);
+		if(chain == nativeFilterOperatorChains.end()){
+			chain = nativeFilterOperatorChains.emplace(filt, std::unique_ptr<nativeFilterOperatorChain>(new nativeFilterOperatorChain)).first;
+		}
+		{
+			std::lock_guard<std::mutex> lock(chain->second->lock);
+			chain->second->operators.push_back(std::move(filterOperator));
+		}
+		/* installed every time since a MATLAB callback may have replaced the native one */
+		helicsFilterSetCustomCallback(filt, &nativeFilterOperatorCallback, chain->second.get(), &err);
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsFilterClearNativeOperators(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFilterClearNativeOperators:rhs","This function requires 1 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFilterClearNativeOperators:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFilter filt = *(static_cast<HelicsFilter*>(mxGetData(argv[0])));
+
+	/* the callback stays installed and passes every message through unchanged */
+	auto chain = nativeFilterOperatorChains.find(filt);
+	if(chain != nativeFilterOperatorChains.end()){
+		std::lock_guard<std::mutex> lock(chain->second->lock);
+		chain->second->operators.clear();
+	}
+}
+
+
@@ -0,0 +1,160 @@
+/* publication data type of each input read through helicsInputGetValue by federate, only fixed types are cached */
+static std::unordered_map<HelicsFederate, std::unordered_map<HelicsInput, int>> inputDataTypeCache;
+
+/* called once a federate and its inputs have been freed */
+static void forgetInputDataTypes(HelicsFederate fed){
+	if(fed == nullptr){
+		inputDataTypeCache.clear();
+	}else{
+		inputDataTypeCache.erase(fed);
+	}
+}
+
+static int getCachedInputDataType(HelicsInput ipt){
+	/* an input with no known federate could outlive its entry so it is not cached */
+	HelicsFederate fed = getInterfaceOwner(ipt);
+	auto inputs = inputDataTypeCache.find(fed);
+	if(inputs != inputDataTypeCache.end()){
+		auto cached = inputs->second.find(ipt);
+		if(cached != inputs->second.end()){
+			return cached->second;
+		}
+	}
+	int dataType = helicsInputGetPublicationDataType(ipt);
+	switch(dataType){
+	case HELICS_DATA_TYPE_UNKNOWN:
+	case HELICS_DATA_TYPE_MULTI:
+	case HELICS_DATA_TYPE_ANY:
+		/* not connected yet or the type can change between values */
+		break;
+	default:
+		if(fed != nullptr){
+			inputDataTypeCache[fed].emplace(ipt, dataType);
+		}
+		break;
+	}
+	return dataType;
+}
+
+/* char row vector from a null terminated string of actualLength bytes including the terminator */
+static mxArray *createInputCharArray(const char *str, int actualLength){
+	mwSize dims[2] = {1, static_cast<mwSize>((actualLength > 0) ? actualLength - 1 : 0)};
+	mxArray *out = mxCreateCharArray(2, dims);
+	mxChar *out_data = mxGetChars(out);
+	for(mwSize i=0; i<dims[1]; ++i){
+		out_data[i] = static_cast<unsigned char>(str[i]);
+	}
+	return out;
+}
+
+void _wrap_helicsInputGetValue(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsInputGetValue:rhs","This function requires 1 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsInputGetValue:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsInput ipt = *(static_cast<HelicsInput*>(mxGetData(argv[0])));
+
+	int dataType = getCachedInputDataType(ipt);
+
+	HelicsError err = helicsErrorInitialize();
+
+	mxArray *_out = nullptr;
+	switch(dataType){
+	case HELICS_DATA_TYPE_DOUBLE:
+		_out = mxCreateDoubleScalar(helicsInputGetDouble(ipt, &err));
+		break;
+	case HELICS_DATA_TYPE_INT:
+		_out = mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL);
+		mxGetInt64s(_out)[0] = static_cast<mxInt64>(helicsInputGetInteger(ipt, &err));
+		break;
+	case HELICS_DATA_TYPE_BOOLEAN:
+		_out = mxCreateLogicalScalar(helicsInputGetBoolean(ipt, &err) == HELICS_TRUE);
+		break;
+	case HELICS_DATA_TYPE_TIME:
+		_out = mxCreateDoubleScalar(helicsInputGetTime(ipt, &err));
+		break;
+	case HELICS_DATA_TYPE_CHAR:
+	{
+		mwSize dims[2] = {1, 1};
+		_out = mxCreateCharArray(2, dims);
+		mxGetChars(_out)[0] = static_cast<unsigned char>(helicsInputGetChar(ipt, &err));
+		break;
+	}
+	case HELICS_DATA_TYPE_COMPLEX:
+	{
+		_out = mxCreateDoubleMatrix(1, 1, mxCOMPLEX);
+		mxComplexDouble *value = mxGetComplexDoubles(_out);
+		helicsInputGetComplex(ipt, &(value->real), &(value->imag), &err);
+		break;
+	}
+	case HELICS_DATA_TYPE_VECTOR:
+	{
+		int maxLength = helicsInputGetVectorSize(ipt);
+		int actualSize = 0;
+		_out = mxCreateDoubleMatrix(maxLength, 1, mxREAL);
+		helicsInputGetVector(ipt, mxGetDoubles(_out), maxLength, &actualSize, &err);
+		mxSetM(_out, actualSize);
+		break;
+	}
+	case HELICS_DATA_TYPE_COMPLEX_VECTOR:
+	{
+		int maxLength = helicsInputGetVectorSize(ipt);
+		int actualSize = 0;
+		_out = mxCreateDoubleMatrix(maxLength/2, 1, mxCOMPLEX);
+		helicsInputGetComplexVector(ipt, reinterpret_cast<double *>(mxGetComplexDoubles(_out)), 2*(maxLength/2), &actualSize, &err);
+		mxSetM(_out, actualSize/2);
+		break;
+	}
+	case HELICS_DATA_TYPE_NAMED_POINT:
+	{
+		int maxStringLen = helicsInputGetStringSize(ipt) + 2;
+		char *name = static_cast<char *>(marshalArena.allocate(maxStringLen));
+		int actualLength = 0;
+		double val = 0;
+		helicsInputGetNamedPoint(ipt, name, maxStringLen, &actualLength, &val, &err);
+		const char *fields[] = {"name", "value"};
+		_out = mxCreateStructMatrix(1, 1, 2, fields);
+		mxSetField(_out, 0, "name", createInputCharArray(name, actualLength));
+		mxSetField(_out, 0, "value", mxCreateDoubleScalar(val));
+		break;
+	}
+	case HELICS_DATA_TYPE_RAW:
+	{
+		int maxDataLen = helicsInputGetByteCount(ipt);
+		int actualSize = 0;
+		_out = mxCreateNumericMatrix(1, maxDataLen, mxUINT8_CLASS, mxREAL);
+		helicsInputGetBytes(ipt, mxGetUint8s(_out), maxDataLen, &actualSize, &err);
+		mxSetN(_out, actualSize);
+		break;
+	}
+	default:
+	{
+		/* strings, JSON and types that are not known yet are returned as their string conversion */
+		int maxStringLen = helicsInputGetStringSize(ipt) + 2;
+		char *outputString = static_cast<char *>(marshalArena.allocate(maxStringLen));
+		int actualLength = 0;
+		helicsInputGetString(ipt, outputString, maxStringLen, &actualLength, &err);
+		_out = createInputCharArray(outputString, actualLength);
+		break;
+	}
+	}
+
+	if(err.error_code != HELICS_OK){
+		mxDestroyArray(_out);
+		throwHelicsMatlabError(&err);
+	}
+
+	resv[0] = _out;
+	if(resc > 1){
+		mxArray *_out1 = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);
+		mxGetInt32s(_out1)[0] = static_cast<mxInt32>(dataType);
+		resv[1] = _out1;
+	}
+}
+
+
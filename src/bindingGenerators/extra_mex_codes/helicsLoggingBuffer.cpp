@@ -0,0 +1,386 @@
+/* one filtered log line waiting in a logging buffer */
+struct helicsMexLogEntry {
+	int level;
+	std::string identifier;
+	std::string message;
+};
+
+/* bounded ring buffer of log lines filled on HELICS threads and drained on the MATLAB thread */
+class helicsMexLogBuffer {
+public:
+	~helicsMexLogBuffer() {
+		stopTimer();
+		if(handler != nullptr){
+			mxDestroyArray(handler);
+		}
+	}
+
+	/* called from the MATLAB thread with the options already validated */
+	void configure(int level, std::unique_ptr<std::regex> pattern, size_t bufferCapacity, mxArray *deliveryHandler, size_t deliveryBatchSize, int intervalMs) {
+		stopTimer();
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			maxLevel = level;
+			messagePattern = std::move(pattern);
+			if(bufferCapacity != entries.size()){
+				/* keep the newest lines that still fit */
+				std::vector<helicsMexLogEntry> retained(bufferCapacity);
+				size_t kept = std::min(count, bufferCapacity);
+				size_t skipped = count - kept;
+				for(size_t ii = 0; ii < kept; ++ii){
+					retained[ii] = std::move(entries[(first + skipped + ii) % entries.size()]);
+				}
+				dropped += skipped;
+				entries = std::move(retained);
+				first = 0;
+				count = kept;
+			}
+			batchSize = deliveryBatchSize;
+		}
+		if(handler != nullptr){
+			mxDestroyArray(handler);
+		}
+		handler = deliveryHandler;
+		if(handler != nullptr && intervalMs > 0){
+			startTimer(std::chrono::milliseconds(intervalMs));
+		}
+	}
+
+	/* called from the MATLAB thread once the object logging into the buffer is freed, lines logged after that are discarded */
+	void retire() {
+		stopTimer();
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			entries.clear();
+			first = 0;
+			count = 0;
+			dropped = 0;
+		}
+		if(handler != nullptr){
+			mxDestroyArray(handler);
+			handler = nullptr;
+		}
+	}
+
+	/* called from HELICS threads, filtering happens before anything is copied */
+	void append(int level, const char *identifier, const char *message) {
+		bool deliver = false;
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			if(level > maxLevel || entries.empty()){
+				return;
+			}
+			if(messagePattern && !std::regex_search(message, *messagePattern)){
+				return;
+			}
+			size_t slot = (first + count) % entries.size();
+			if(count == entries.size()){
+				/* full, the oldest line is overwritten */
+				first = (first + 1) % entries.size();
+				++dropped;
+			}else{
+				++count;
+			}
+			entries[slot].level = level;
+			entries[slot].identifier.assign(identifier);
+			entries[slot].message.assign(message);
+			deliver = (batchSize > 0 && count >= batchSize);
+		}
+		if(deliver){
+			requestDelivery();
+		}
+	}
+
+	/* struct array of up to maxCount of the oldest lines, which are removed from the buffer */
+	mxArray *drain(size_t maxCount, double *droppedCount) {
+		const char *fields[] = {"level", "identifier", "message"};
+		std::lock_guard<std::mutex> guard(lock);
+		size_t drainCount = std::min(count, maxCount);
+		mxArray *out = mxCreateStructMatrix(drainCount, 1, 3, fields);
+		for(size_t ii = 0; ii < drainCount; ++ii){
+			helicsMexLogEntry &entry = entries[first];
+			mxSetFieldByNumber(out, ii, 0, mxCreateDoubleScalar(static_cast<double>(entry.level)));
+			mxSetFieldByNumber(out, ii, 1, mxCreateString(entry.identifier.c_str()));
+			mxSetFieldByNumber(out, ii, 2, mxCreateString(entry.message.c_str()));
+			entry.identifier.clear();
+			entry.message.clear();
+			first = (first + 1) % entries.size();
+			--count;
+		}
+		*droppedCount = static_cast<double>(dropped);
+		dropped = 0;
+		return out;
+	}
+
+	/* runs on the MATLAB thread from the callback queue */
+	void deliver() {
+		deliveryQueued.store(false);
+		if(handler == nullptr){
+			return;
+		}
+		double droppedCount = 0.0;
+		mxArray *rhs[3];
+		rhs[0] = handler;
+		rhs[1] = drain(std::numeric_limits<size_t>::max(), &droppedCount);
+		if(mxGetNumberOfElements(rhs[1]) == 0 && droppedCount == 0.0){
+			mxDestroyArray(rhs[1]);
+			return;
+		}
+		rhs[2] = mxCreateDoubleScalar(droppedCount);
+		mxArray *lhs = nullptr;
+		callMatlabFunction(0, &lhs, 3, rhs);
+		mxDestroyArray(rhs[1]);
+		mxDestroyArray(rhs[2]);
+	}
+
+private:
+	void requestDelivery() {
+		if(!deliveryQueued.exchange(true)){
+			queueCallbackEvent([this](){ deliver(); });
+		}
+	}
+
+	void startTimer(std::chrono::milliseconds interval) {
+		timerStopping = false;
+		timer = std::thread([this, interval](){
+			std::unique_lock<std::mutex> timerGuard(timerLock);
+			while(!timerWakeup.wait_for(timerGuard, interval, [this]{ return timerStopping; })){
+				bool pending = false;
+				{
+					std::lock_guard<std::mutex> guard(lock);
+					pending = (count > 0 || dropped > 0);
+				}
+				if(pending){
+					requestDelivery();
+				}
+			}
+		});
+	}
+
+	void stopTimer() {
+		if(timer.joinable()){
+			{
+				std::lock_guard<std::mutex> timerGuard(timerLock);
+				timerStopping = true;
+			}
+			timerWakeup.notify_all();
+			timer.join();
+		}
+	}
+
+	std::mutex lock;
+	std::vector<helicsMexLogEntry> entries;
+	size_t first = 0;
+	size_t count = 0;
+	size_t dropped = 0;
+	int maxLevel = std::numeric_limits<int>::max();
+	std::unique_ptr<std::regex> messagePattern;
+	size_t batchSize = 0;
+	mxArray *handler = nullptr;
+	std::atomic<bool> deliveryQueued{false};
+	std::thread timer;
+	std::mutex timerLock;
+	std::condition_variable timerWakeup;
+	bool timerStopping = false;
+};
+
+/* the buffer of each federate, core or broker one was set for */
+static std::unordered_map<void *, std::unique_ptr<helicsMexLogBuffer>> loggingBuffers;
+/* buffers of freed objects, HELICS may log into them until the object is gone and queued deliveries point at them,
+   so they are kept empty and only freed when the mex file unloads */
+static std::vector<std::unique_ptr<helicsMexLogBuffer>> retiredLoggingBuffers;
+
+/* called once a federate, core or broker has been freed, its buffer stops and the object key can be reused */
+static void retireLoggingBuffer(void *object){
+	for(auto buffer = loggingBuffers.begin(); buffer != loggingBuffers.end();){
+		if(object != nullptr && buffer->first != object){
+			++buffer;
+			continue;
+		}
+		buffer->second->retire();
+		retiredLoggingBuffers.push_back(std::move(buffer->second));
+		buffer = loggingBuffers.erase(buffer);
+	}
+}
+
+static void helicsMexLogBufferCallback(int loglevel, const char *identifier, const char *message, void *userData){
+	static_cast<helicsMexLogBuffer *>(userData)->append(loglevel, identifier, message);
+}
+
+/* parse the options struct shared by the helics*SetLoggingBuffer functions and attach the buffer to obj */
+static helicsMexLogBuffer *configureLoggingBuffer(const char *functionName, void *obj, int argc, const mxArray *argv[]){
+	std::string errorId = std::string("MATLAB:") + functionName + ":TypeError";
+	const mxArray *options = nullptr;
+	if(argc > 1 && !mxIsEmpty(argv[1])){
+		if(!mxIsStruct(argv[1]) || mxGetNumberOfElements(argv[1]) != 1){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt(errorId.c_str(),"Argument 2 must be a scalar struct of logging buffer options.");
+		}
+		options = argv[1];
+	}
+	auto getScalarOption = [&](const char *field, double defaultValue){
+		const mxArray *value = (options != nullptr) ? mxGetField(options, 0, field) : nullptr;
+		if(value == nullptr){
+			return defaultValue;
+		}
+		if(!mxIsNumeric(value) || mxIsComplex(value) || mxGetNumberOfElements(value) != 1 || mxGetScalar(value) < 0.0){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt(errorId.c_str(),(std::string("Option '") + field + "' must be a non negative scalar.").c_str());
+		}
+		return mxGetScalar(value);
+	};
+
+	int level = static_cast<int>(getScalarOption("level", static_cast<double>(std::numeric_limits<int>::max())));
+	size_t capacity = static_cast<size_t>(getScalarOption("capacity", 10000.0));
+	int interval = static_cast<int>(getScalarOption("interval", 0.0));
+
+	size_t batchSize = 0;
+	const mxArray *handlerValue = (options != nullptr) ? mxGetField(options, 0, "callback") : nullptr;
+	if(handlerValue != nullptr && !mxIsEmpty(handlerValue)){
+		if(mxGetClassID(handlerValue) != mxFUNCTION_CLASS){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt(errorId.c_str(),"Option 'callback' must be a function handle.");
+		}
+		batchSize = static_cast<size_t>(getScalarOption("batchSize", 100.0));
+	}
+
+	std::unique_ptr<std::regex> pattern;
+	const mxArray *patternValue = (options != nullptr) ? mxGetField(options, 0, "pattern") : nullptr;
+	if(patternValue != nullptr && !mxIsEmpty(patternValue)){
+		if(!mxIsChar(patternValue)){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt(errorId.c_str(),"Option 'pattern' must be a string.");
+		}
+		char *patternString = mxArrayToUTF8String(patternValue);
+		try {
+			pattern.reset(new std::regex(patternString));
+		}
+		catch(const std::regex_error &){
+			mxFree(patternString);
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt(errorId.c_str(),"Option 'pattern' is not a valid regular expression.");
+		}
+		mxFree(patternString);
+	}
+
+	mxArray *handler = nullptr;
+	if(handlerValue != nullptr && !mxIsEmpty(handlerValue)){
+		handler = mxDuplicateArray(handlerValue);
+		mexMakeArrayPersistent(handler);
+	}
+
+	auto buffer = loggingBuffers.find(obj);
+	if(buffer == loggingBuffers.end()){
+		buffer = loggingBuffers.emplace(obj, std::unique_ptr<helicsMexLogBuffer>(new helicsMexLogBuffer)).first;
+	}
+	buffer->second->configure(level, std::move(pattern), capacity, handler, batchSize, interval);
+	return buffer->second.get();
+}
+
+void _wrap_helicsFederateSetLoggingBuffer(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 1 || argc > 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetLoggingBuffer:rhs","This function requires at least 1 arguments and at most 2 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetLoggingBuffer:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+
+	helicsMexLogBuffer *buffer = configureLoggingBuffer("helicsFederateSetLoggingBuffer", fed, argc, argv);
+
+	HelicsError err = helicsErrorInitialize();
+
+	helicsFederateSetLoggingCallback(fed, &helicsMexLogBufferCallback, buffer, &err);
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsCoreSetLoggingBuffer(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 1 || argc > 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsCoreSetLoggingBuffer:rhs","This function requires at least 1 arguments and at most 2 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsCoreSetLoggingBuffer:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsCore core = *(static_cast<HelicsCore*>(mxGetData(argv[0])));
+
+	helicsMexLogBuffer *buffer = configureLoggingBuffer("helicsCoreSetLoggingBuffer", core, argc, argv);
+
+	HelicsError err = helicsErrorInitialize();
+
+	helicsCoreSetLoggingCallback(core, &helicsMexLogBufferCallback, buffer, &err);
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsBrokerSetLoggingBuffer(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 1 || argc > 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsBrokerSetLoggingBuffer:rhs","This function requires at least 1 arguments and at most 2 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsBrokerSetLoggingBuffer:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsBroker broker = *(static_cast<HelicsBroker*>(mxGetData(argv[0])));
+
+	helicsMexLogBuffer *buffer = configureLoggingBuffer("helicsBrokerSetLoggingBuffer", broker, argc, argv);
+
+	HelicsError err = helicsErrorInitialize();
+
+	helicsBrokerSetLoggingCallback(broker, &helicsMexLogBufferCallback, buffer, &err);
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsLoggingBufferDrain(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 1 || argc > 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsLoggingBufferDrain:rhs","This function requires at least 1 arguments and at most 2 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsLoggingBufferDrain:TypeError","Argument 1 must be of type uint64.");
+	}
+	void *obj = *(static_cast<void**>(mxGetData(argv[0])));
+
+	size_t maxCount = std::numeric_limits<size_t>::max();
+	if(argc > 1){
+		if(!mxIsNumeric(argv[1]) || mxGetNumberOfElements(argv[1]) != 1 || mxGetScalar(argv[1]) < 0.0){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsLoggingBufferDrain:TypeError","Argument 2 must be a non negative scalar.");
+		}
+		maxCount = static_cast<size_t>(mxGetScalar(argv[1]));
+	}
+
+	auto buffer = loggingBuffers.find(obj);
+	if(buffer == loggingBuffers.end()){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsLoggingBufferDrain:TypeError","No logging buffer is set for this object.");
+	}
+
+	double droppedCount = 0.0;
+	resv[0] = buffer->second->drain(maxCount, &droppedCount);
+	if(resc > 1){
+		resv[1] = mxCreateDoubleScalar(droppedCount);
+	}
+}
+
+
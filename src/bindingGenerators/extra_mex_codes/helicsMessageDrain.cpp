@@ -0,0 +1,146 @@
+/* fields of the struct a message is converted to, flags holds flag k of the message in bit k */
+static const char *messageStructFields[] = {"source", "destination", "originalSource", "originalDestination", "time", "messageID", "flags", "data"};
+static const int messageStructFieldCount = 8;
+
+static mxUint16 getMessageFlags(HelicsMessage message){
+	mxUint16 bits = 0;
+	for(int flag = 0; flag < 16; ++flag){
+		if(helicsMessageGetFlagOption(message, flag) == HELICS_TRUE){
+			bits |= static_cast<mxUint16>(1U << flag);
+		}
+	}
+	return bits;
+}
+
+static mxArray *getMessageData(HelicsMessage message){
+	int byteCount = helicsMessageGetByteCount(message);
+	mxArray *data = mxCreateUninitNumericMatrix(1, byteCount, mxUINT8_CLASS, mxREAL);
+	if(byteCount > 0){
+		memcpy(mxGetUint8s(data), helicsMessageGetBytesPointer(message), byteCount);
+	}
+	return data;
+}
+
+/* fill element index of a struct array created with messageStructFields */
+static void setMessageStructFields(mxArray *out, size_t index, HelicsMessage message){
+	mxSetFieldByNumber(out, index, 0, mxCreateString(helicsMessageGetSource(message)));
+	mxSetFieldByNumber(out, index, 1, mxCreateString(helicsMessageGetDestination(message)));
+	mxSetFieldByNumber(out, index, 2, mxCreateString(helicsMessageGetOriginalSource(message)));
+	mxSetFieldByNumber(out, index, 3, mxCreateString(helicsMessageGetOriginalDestination(message)));
+	mxSetFieldByNumber(out, index, 4, mxCreateDoubleScalar(helicsMessageGetTime(message)));
+	mxSetFieldByNumber(out, index, 5, mxCreateDoubleScalar(static_cast<double>(helicsMessageGetMessageID(message))));
+	mxArray *flags = mxCreateNumericMatrix(1, 1, mxUINT16_CLASS, mxREAL);
+	mxGetUint16s(flags)[0] = getMessageFlags(message);
+	mxSetFieldByNumber(out, index, 6, flags);
+	mxSetFieldByNumber(out, index, 7, getMessageData(message));
+}
+
+/* pull up to maxCount pending messages and convert them in one pass, the messages are freed before returning */
+static void drainMessages(const char *functionName, int resc, mxArray *resv[], int argc, const mxArray *argv[], void *object, HelicsMessage (*getMessage)(void *), int pendingCount){
+	std::string errorId = std::string("MATLAB:") + functionName + ":TypeError";
+	size_t maxCount = std::numeric_limits<size_t>::max();
+	if(argc > 1 && !mxIsEmpty(argv[1])){
+		if(!mxIsNumeric(argv[1]) || mxGetNumberOfElements(argv[1]) != 1 || mxGetScalar(argv[1]) < 0.0){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt(errorId.c_str(),"Argument 2 must be a non negative scalar message count.");
+		}
+		maxCount = static_cast<size_t>(mxGetScalar(argv[1]));
+	}
+	bool columnar = false;
+	if(argc > 2){
+		if(!mxIsLogical(argv[2]) && !mxIsNumeric(argv[2])){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt(errorId.c_str(),"Argument 3 must be a logical type or a 0 or 1.");
+		}
+		columnar = (mxGetScalar(argv[2]) != 0.0);
+	}
+
+	std::vector<HelicsMessage> messages;
+	messages.reserve(std::min(maxCount, static_cast<size_t>(std::max(pendingCount, 0))));
+	while(messages.size() < maxCount){
+		HelicsMessage message = getMessage(object);
+		if(message == nullptr){
+			break;
+		}
+		messages.push_back(message);
+	}
+
+	size_t count = messages.size();
+	mxArray *_out = nullptr;
+	if(columnar){
+		/* one field per message property, strings and payloads in count x 1 cells, times and ids in double columns and flags in a uint16 column */
+		_out = mxCreateStructMatrix(1, 1, messageStructFieldCount, messageStructFields);
+		for(int field = 0; field < 4; ++field){
+			mxSetFieldByNumber(_out, 0, field, mxCreateCellMatrix(count, 1));
+		}
+		mxSetFieldByNumber(_out, 0, 4, mxCreateDoubleMatrix(count, 1, mxREAL));
+		mxSetFieldByNumber(_out, 0, 5, mxCreateDoubleMatrix(count, 1, mxREAL));
+		mxSetFieldByNumber(_out, 0, 6, mxCreateNumericMatrix(count, 1, mxUINT16_CLASS, mxREAL));
+		mxSetFieldByNumber(_out, 0, 7, mxCreateCellMatrix(count, 1));
+		double *pTimes = mxGetDoubles(mxGetFieldByNumber(_out, 0, 4));
+		double *pIds = mxGetDoubles(mxGetFieldByNumber(_out, 0, 5));
+		mxUint16 *pFlags = mxGetUint16s(mxGetFieldByNumber(_out, 0, 6));
+		for(size_t ii = 0; ii < count; ++ii){
+			HelicsMessage message = messages[ii];
+			mxSetCell(mxGetFieldByNumber(_out, 0, 0), ii, mxCreateString(helicsMessageGetSource(message)));
+			mxSetCell(mxGetFieldByNumber(_out, 0, 1), ii, mxCreateString(helicsMessageGetDestination(message)));
+			mxSetCell(mxGetFieldByNumber(_out, 0, 2), ii, mxCreateString(helicsMessageGetOriginalSource(message)));
+			mxSetCell(mxGetFieldByNumber(_out, 0, 3), ii, mxCreateString(helicsMessageGetOriginalDestination(message)));
+			pTimes[ii] = helicsMessageGetTime(message);
+			pIds[ii] = static_cast<double>(helicsMessageGetMessageID(message));
+			pFlags[ii] = getMessageFlags(message);
+			mxSetCell(mxGetFieldByNumber(_out, 0, 7), ii, getMessageData(message));
+			helicsMessageFree(message);
+		}
+	}else{
+		_out = mxCreateStructMatrix(count, 1, messageStructFieldCount, messageStructFields);
+		for(size_t ii = 0; ii < count; ++ii){
+			setMessageStructFields(_out, ii, messages[ii]);
+			helicsMessageFree(messages[ii]);
+		}
+	}
+
+	resv[0] = _out;
+}
+
+
+void _wrap_helicsEndpointGetAllMessages(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 1 || argc > 3){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointGetAllMessages:rhs","This function requires at least 1 arguments and at most 3 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointGetAllMessages:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsEndpoint endpoint = *(static_cast<HelicsEndpoint*>(mxGetData(argv[0])));
+	if(helicsEndpointIsValid(endpoint) != HELICS_TRUE){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("helics:invalid_object","The given endpoint object is not valid.");
+	}
+
+	drainMessages("helicsEndpointGetAllMessages", resc, resv, argc, argv, endpoint, [](void *object){ return helicsEndpointGetMessage(static_cast<HelicsEndpoint>(object)); }, helicsEndpointPendingMessageCount(endpoint));
+}
+
+
+void _wrap_helicsFederateGetAllMessages(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 1 || argc > 3){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetAllMessages:rhs","This function requires at least 1 arguments and at most 3 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetAllMessages:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+	if(helicsFederateIsValid(fed) != HELICS_TRUE){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("helics:invalid_object","The given federate object is not valid.");
+	}
+
+	drainMessages("helicsFederateGetAllMessages", resc, resv, argc, argv, fed, [](void *object){ return helicsFederateGetMessage(static_cast<HelicsFederate>(object)); }, helicsFederatePendingMessageCount(fed));
+}
+
+
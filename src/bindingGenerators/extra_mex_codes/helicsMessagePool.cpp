@@ -0,0 +1,282 @@
+/* messages created for a federate ahead of time and reused after they are sent or released */
+struct helicsMexMessagePool {
+	std::vector<HelicsMessage> available;
+	size_t capacity = 0;
+	int reserveSize = 0;
+	double hits = 0.0;
+	double misses = 0.0;
+	double recycled = 0.0;
+	size_t outstanding = 0;
+};
+
+static std::unordered_map<HelicsFederate, helicsMexMessagePool> messagePools;
+/* federate of every message handed out by a pool that has not come back yet */
+static std::unordered_map<HelicsMessage, HelicsFederate> pooledMessageOwners;
+
+/* called once HELICS has freed the messages of a federate, a null federate drops every pool */
+static void dropMessagePool(HelicsFederate fed){
+	if(fed == nullptr){
+		messagePools.clear();
+		pooledMessageOwners.clear();
+		return;
+	}
+	for(auto owner = pooledMessageOwners.begin(); owner != pooledMessageOwners.end();){
+		owner = (owner->second == fed) ? pooledMessageOwners.erase(owner) : std::next(owner);
+	}
+	messagePools.erase(fed);
+}
+
+/* called once a message from a pool has been freed instead of going back to the pool */
+static void forgetPooledMessage(HelicsMessage message){
+	auto owner = pooledMessageOwners.find(message);
+	if(owner == pooledMessageOwners.end()){
+		return;
+	}
+	auto pool = messagePools.find(owner->second);
+	if(pool != messagePools.end()){
+		--pool->second.outstanding;
+	}
+	pooledMessageOwners.erase(owner);
+}
+
+/* the pool of a federate, a pool left from a federate that was freed outside the registry is dropped since its messages went with it */
+static helicsMexMessagePool *getMessagePool(HelicsFederate fed, bool create){
+	auto pool = messagePools.find(fed);
+	if(pool != messagePools.end() && !isHelicsObjectLive(fed, HELICS_MEX_FEDERATE)){
+		dropMessagePool(fed);
+		pool = messagePools.end();
+	}
+	if(pool == messagePools.end()){
+		if(!create){
+			return nullptr;
+		}
+		pool = messagePools.emplace(fed, helicsMexMessagePool()).first;
+	}
+	return &pool->second;
+}
+
+static HelicsMessage createPooledMessage(HelicsFederate fed, int reserveSize, HelicsError *err){
+	HelicsMessage message = helicsFederateCreateMessage(fed, err);
+	trackHelicsObject(HELICS_MEX_MESSAGE, message, fed);
+	if(err->error_code == HELICS_OK && reserveSize > 0){
+		helicsMessageReserve(message, reserveSize, err);
+	}
+	return message;
+}
+
+/* clear a message that came from a pool and put it back, messages beyond the pool capacity are freed */
+static void recyclePooledMessage(HelicsMessage message, HelicsError *err){
+	auto owner = pooledMessageOwners.find(message);
+	if(owner == pooledMessageOwners.end()){
+		return;
+	}
+	helicsMexMessagePool *pool = getMessagePool(owner->second, false);
+	pooledMessageOwners.erase(owner);
+	if(pool == nullptr){
+		return;
+	}
+	--pool->outstanding;
+	if(pool->available.size() >= pool->capacity){
+		helicsMessageFree(message);
+		releaseHelicsObject(message);
+		return;
+	}
+	helicsMessageClear(message, err);
+	if(err->error_code == HELICS_OK && pool->reserveSize > 0){
+		helicsMessageReserve(message, pool->reserveSize, err);
+	}
+	if(err->error_code != HELICS_OK){
+		helicsMessageFree(message);
+		releaseHelicsObject(message);
+		return;
+	}
+	pool->available.push_back(message);
+	pool->recycled += 1.0;
+}
+
+static HelicsMessage getPooledMessageArgument(const char *functionName, const mxArray *arg, int position){
+	if(mxGetClassID(arg) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt((std::string("MATLAB:") + functionName + ":TypeError").c_str(),("Argument " + std::to_string(position) + " must be of type uint64.").c_str());
+	}
+	return *(static_cast<HelicsMessage*>(mxGetData(arg)));
+}
+
+void _wrap_helicsFederateSetMessagePool(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 2 || argc > 3){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetMessagePool:rhs","This function requires at least 2 arguments and at most 3 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetMessagePool:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+	if(helicsFederateIsValid(fed) != HELICS_TRUE){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("helics:invalid_object","The given federate object is not valid.");
+	}
+
+	if(!mxIsNumeric(argv[1]) || mxGetNumberOfElements(argv[1]) != 1 || mxGetScalar(argv[1]) < 0.0){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetMessagePool:TypeError","Argument 2 must be a non negative scalar message count.");
+	}
+	size_t capacity = static_cast<size_t>(mxGetScalar(argv[1]));
+
+	int reserveSize = 0;
+	if(argc > 2){
+		if(!mxIsNumeric(argv[2]) || mxGetNumberOfElements(argv[2]) != 1 || mxGetScalar(argv[2]) < 0.0){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetMessagePool:TypeError","Argument 3 must be a non negative scalar size in bytes.");
+		}
+		reserveSize = static_cast<int>(mxGetScalar(argv[2]));
+	}
+
+	helicsMexMessagePool *pool = getMessagePool(fed, true);
+	pool->capacity = capacity;
+	pool->reserveSize = reserveSize;
+
+	HelicsError err = helicsErrorInitialize();
+
+	while(pool->available.size() > capacity){
+		helicsMessageFree(pool->available.back());
+		releaseHelicsObject(pool->available.back());
+		pool->available.pop_back();
+	}
+	for(HelicsMessage message : pool->available){
+		if(reserveSize > 0 && err.error_code == HELICS_OK){
+			helicsMessageReserve(message, reserveSize, &err);
+		}
+	}
+	while(pool->available.size() < capacity && err.error_code == HELICS_OK){
+		HelicsMessage message = createPooledMessage(fed, reserveSize, &err);
+		if(message != nullptr){
+			pool->available.push_back(message);
+		}
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsFederateGetPooledMessage(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetPooledMessage:rhs","This function requires 1 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetPooledMessage:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+	if(helicsFederateIsValid(fed) != HELICS_TRUE){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("helics:invalid_object","The given federate object is not valid.");
+	}
+
+	helicsMexMessagePool *pool = getMessagePool(fed, true);
+
+	HelicsError err = helicsErrorInitialize();
+
+	HelicsMessage message = nullptr;
+	if(!pool->available.empty()){
+		message = pool->available.back();
+		pool->available.pop_back();
+		pool->hits += 1.0;
+	}else{
+		message = createPooledMessage(fed, pool->reserveSize, &err);
+		pool->misses += 1.0;
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+	pooledMessageOwners[message] = fed;
+	++pool->outstanding;
+
+	mxArray *_out = mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL);
+	mxGetUint64s(_out)[0] = reinterpret_cast<mxUint64>(message);
+	resv[0] = _out;
+}
+
+
+void _wrap_helicsEndpointSendPooledMessage(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendPooledMessage:rhs","This function requires 2 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsEndpointSendPooledMessage:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsEndpoint endpoint = *(static_cast<HelicsEndpoint*>(mxGetData(argv[0])));
+	HelicsMessage message = getPooledMessageArgument("helicsEndpointSendPooledMessage", argv[1], 2);
+
+	HelicsError err = helicsErrorInitialize();
+
+	/* HELICS copies the message when it is sent so it can go straight back to the pool */
+	helicsEndpointSendMessage(endpoint, message, &err);
+	if(err.error_code == HELICS_OK){
+		recyclePooledMessage(message, &err);
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsMessageReleaseToPool(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsMessageReleaseToPool:rhs","This function requires 1 arguments.");
+	}
+
+	HelicsMessage message = getPooledMessageArgument("helicsMessageReleaseToPool", argv[0], 1);
+
+	HelicsError err = helicsErrorInitialize();
+
+	recyclePooledMessage(message, &err);
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsFederateGetMessagePoolStatistics(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetMessagePoolStatistics:rhs","This function requires 1 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateGetMessagePoolStatistics:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+
+	helicsMexMessagePool emptyPool;
+	helicsMexMessagePool *pool = getMessagePool(fed, false);
+	if(pool == nullptr){
+		pool = &emptyPool;
+	}
+
+	const char *fields[] = {"capacity", "reserveSize", "available", "outstanding", "hits", "misses", "recycled"};
+	mxArray *_out = mxCreateStructMatrix(1, 1, 7, fields);
+	mxSetFieldByNumber(_out, 0, 0, mxCreateDoubleScalar(static_cast<double>(pool->capacity)));
+	mxSetFieldByNumber(_out, 0, 1, mxCreateDoubleScalar(static_cast<double>(pool->reserveSize)));
+	mxSetFieldByNumber(_out, 0, 2, mxCreateDoubleScalar(static_cast<double>(pool->available.size())));
+	mxSetFieldByNumber(_out, 0, 3, mxCreateDoubleScalar(static_cast<double>(pool->outstanding)));
+	mxSetFieldByNumber(_out, 0, 4, mxCreateDoubleScalar(pool->hits));
+	mxSetFieldByNumber(_out, 0, 5, mxCreateDoubleScalar(pool->misses));
+	mxSetFieldByNumber(_out, 0, 6, mxCreateDoubleScalar(pool->recycled));
+	resv[0] = _out;
+}
+
+
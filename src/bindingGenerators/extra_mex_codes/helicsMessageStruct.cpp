@@ -0,0 +1,169 @@
+void _wrap_helicsMessageToStruct(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsMessageToStruct:rhs","This function requires 1 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsMessageToStruct:TypeError","Argument 1 must be of type uint64.");
+	}
+	size_t count = mxGetNumberOfElements(argv[0]);
+	const HelicsMessage *messages = static_cast<const HelicsMessage *>(mxGetData(argv[0]));
+	for(size_t ii = 0; ii < count; ++ii){
+		if(helicsMessageIsValid(messages[ii]) != HELICS_TRUE){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("helics:invalid_object","The given message object is not valid.");
+		}
+	}
+
+	mxArray *_out = mxCreateStructArray(mxGetNumberOfDimensions(argv[0]), mxGetDimensions(argv[0]), messageStructFieldCount, messageStructFields);
+	for(size_t ii = 0; ii < count; ++ii){
+		setMessageStructFields(_out, ii, messages[ii]);
+	}
+
+	resv[0] = _out;
+}
+
+
+/* a string field of element index copied into the arena, nullptr if the field is missing or empty */
+static const char *getMessageStructString(const mxArray *values, size_t index, const char *fieldName){
+	const mxArray *value = mxGetField(values, index, fieldName);
+	if(value == nullptr || mxIsEmpty(value)){
+		return nullptr;
+	}
+	size_t length = mxGetNumberOfElements(value) + 1;
+	char *str = static_cast<char *>(marshalArena.allocate(length));
+	mxGetString(value, str, length);
+	return str;
+}
+
+/* a numeric scalar field of element index, false if the field is missing or empty */
+static bool getMessageStructScalar(const mxArray *values, size_t index, const char *fieldName, double *result){
+	const mxArray *value = mxGetField(values, index, fieldName);
+	if(value == nullptr || mxIsEmpty(value)){
+		return false;
+	}
+	*result = mxGetScalar(value);
+	return true;
+}
+
+/* check the type of every field before any message is created so a type error does not leave messages behind */
+static void checkMessageStruct(const mxArray *values, size_t count){
+	for(size_t ii = 0; ii < count; ++ii){
+		for(int field = 0; field < messageStructFieldCount; ++field){
+			const mxArray *value = mxGetField(values, ii, messageStructFields[field]);
+			if(value == nullptr || mxIsEmpty(value)){
+				continue;
+			}
+			bool valid = true;
+			const char *expected = nullptr;
+			if(field < 4){
+				valid = mxIsChar(value);
+				expected = "a string";
+			}else if(field < 7){
+				valid = mxIsNumeric(value) && mxGetNumberOfElements(value) == 1;
+				expected = "a numeric scalar";
+			}else{
+				valid = mxIsChar(value) || mxIsUint8(value);
+				expected = "a string or an array of type uint8";
+			}
+			if(!valid){
+				mexUnlock();
+				helicsMexErrMsgIdAndTxt("MATLAB:helicsMessageFromStruct:TypeError",(std::string("The ") + messageStructFields[field] + " field must be " + expected + ".").c_str());
+			}
+		}
+	}
+}
+
+static void setMessageFromStruct(HelicsMessage message, const mxArray *values, size_t index, HelicsError *err){
+	const char *str = nullptr;
+	if((str = getMessageStructString(values, index, "source")) != nullptr){
+		helicsMessageSetSource(message, str, err);
+	}
+	if(err->error_code == HELICS_OK && (str = getMessageStructString(values, index, "destination")) != nullptr){
+		helicsMessageSetDestination(message, str, err);
+	}
+	if(err->error_code == HELICS_OK && (str = getMessageStructString(values, index, "originalSource")) != nullptr){
+		helicsMessageSetOriginalSource(message, str, err);
+	}
+	if(err->error_code == HELICS_OK && (str = getMessageStructString(values, index, "originalDestination")) != nullptr){
+		helicsMessageSetOriginalDestination(message, str, err);
+	}
+	double scalar = 0.0;
+	if(err->error_code == HELICS_OK && getMessageStructScalar(values, index, "time", &scalar)){
+		helicsMessageSetTime(message, scalar, err);
+	}
+	if(err->error_code == HELICS_OK && getMessageStructScalar(values, index, "messageID", &scalar)){
+		helicsMessageSetMessageID(message, static_cast<int32_t>(scalar), err);
+	}
+	if(err->error_code == HELICS_OK && getMessageStructScalar(values, index, "flags", &scalar)){
+		unsigned int bits = static_cast<unsigned int>(scalar);
+		helicsMessageClearFlags(message);
+		for(int flag = 0; flag < 16 && err->error_code == HELICS_OK; ++flag){
+			if((bits & (1U << flag)) != 0U){
+				helicsMessageSetFlagOption(message, flag, HELICS_TRUE, err);
+			}
+		}
+	}
+	const mxArray *data = mxGetField(values, index, "data");
+	if(err->error_code == HELICS_OK && data != nullptr && !mxIsEmpty(data)){
+		int dataLength = 0;
+		const void *bytes = getBytePayload(data, &dataLength);
+		helicsMessageSetData(message, bytes, dataLength, err);
+	}
+}
+
+void _wrap_helicsMessageFromStruct(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsMessageFromStruct:rhs","This function requires 2 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsMessageFromStruct:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+	if(helicsFederateIsValid(fed) != HELICS_TRUE){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("helics:invalid_object","The given federate object is not valid.");
+	}
+
+	if(!mxIsStruct(argv[1])){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsMessageFromStruct:TypeError","Argument 2 must be a struct with fields named as in helicsMessageToStruct.");
+	}
+	size_t count = mxGetNumberOfElements(argv[1]);
+	checkMessageStruct(argv[1], count);
+
+	mxArray *_out = mxCreateNumericArray(mxGetNumberOfDimensions(argv[1]), mxGetDimensions(argv[1]), mxUINT64_CLASS, mxREAL);
+	mxUint64 *rv = mxGetUint64s(_out);
+
+	HelicsError err = helicsErrorInitialize();
+
+	size_t created = 0;
+	for(; created < count && err.error_code == HELICS_OK; ++created){
+		HelicsMessage message = helicsFederateCreateMessage(fed, &err);
+		rv[created] = reinterpret_cast<mxUint64>(message);
+		trackHelicsObject(HELICS_MEX_MESSAGE, message, fed);
+		if(message != nullptr){
+			setMessageFromStruct(message, argv[1], created, &err);
+		}
+	}
+
+	if(err.error_code != HELICS_OK){
+		for(size_t ii = 0; ii < created; ++ii){
+			if(rv[ii] != 0){
+				helicsMessageFree(reinterpret_cast<HelicsMessage>(rv[ii]));
+				releaseHelicsObject(reinterpret_cast<HelicsMessage>(rv[ii]));
+			}
+		}
+		mxDestroyArray(_out);
+		throwHelicsMatlabError(&err);
+	}
+
+	resv[0] = _out;
+}
+
+
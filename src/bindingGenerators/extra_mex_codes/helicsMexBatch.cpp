@@ -0,0 +1,106 @@
+static wrapperFunction getWrapperFunction(int functionId);
+static int getWrapperFunctionId(const mxArray *functionArg);
+
+/* clears batchCallDepth however the batch loop is left */
+struct batchCallGuard {
+	batchCallGuard() { batchCallDepth = mexCallDepth; }
+	~batchCallGuard() { batchCallDepth = 0; }
+};
+
+void _wrap_helicsMexBatch(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 1 || argc > 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:__batch:rhs","This function requires at least 1 arguments and at most 2 arguments.");
+	}
+
+	if(batchCallDepth != 0){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:__batch:nested","Batch calls cannot be nested.");
+	}
+
+	if(!mxIsCell(argv[0])){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:__batch:TypeError","Argument 1 must be a cell array of {function, args...} cell arrays.");
+	}
+	size_t callCount = mxGetNumberOfElements(argv[0]);
+
+	std::vector<int> outputCounts(callCount, 1);
+	if(argc > 1){
+		size_t countCount = mxGetNumberOfElements(argv[1]);
+		if(!mxIsDouble(argv[1]) || mxIsComplex(argv[1]) || (countCount != 1 && countCount != callCount)){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:__batch:TypeError","Argument 2 must be a double scalar or have one output count per call.");
+		}
+		/* checked before any call is made so a bad count never reaches a wrapper */
+		const double *counts = mxGetDoubles(argv[1]);
+		for(size_t ii = 0; ii < callCount; ++ii){
+			double count = counts[(countCount == 1) ? 0 : ii];
+			if(!(count >= 1.0 && count <= static_cast<double>(std::numeric_limits<int>::max())) || count != static_cast<double>(static_cast<int>(count))){
+				mexUnlock();
+				helicsMexErrMsgIdAndTxt("helics:mexFunction","Each batch output count must be a positive integer.");
+			}
+			outputCounts[ii] = static_cast<int>(count);
+		}
+	}
+
+	mxArray *results = mxCreateCellMatrix(mxGetM(argv[0]), mxGetN(argv[0]));
+	const char *statusFields[] = {"identifier", "message"};
+	mxArray *status = mxCreateStructMatrix(mxGetM(argv[0]), mxGetN(argv[0]), 2, statusFields);
+	mxArray *emptyArg = mxCreateDoubleMatrix(0, 0, mxREAL);
+
+	std::vector<const mxArray *> callArgs;
+	std::vector<mxArray *> callOutputs;
+	{
+		batchCallGuard guard;
+		for(size_t ii = 0; ii < callCount; ++ii){
+			int callOutputCount = outputCounts[ii];
+			callOutputs.assign(callOutputCount, nullptr);
+			try {
+				const mxArray *call = mxGetCell(argv[0], ii);
+				if(call == nullptr || !mxIsCell(call) || mxGetNumberOfElements(call) < 1){
+					throw helicsMexCallError{"helics:batch:invalid_call", "Each batch call must be a cell array {function, args...}."};
+				}
+				wrapperFunction wrapper = getWrapperFunction(getWrapperFunctionId(mxGetCell(call, 0)));
+				if(wrapper == nullptr){
+					throw helicsMexCallError{"helics:mexFunction", "An unknown function id was encountered. Call the mex function with a valid function id."};
+				}
+				size_t callArgCount = mxGetNumberOfElements(call) - 1;
+				callArgs.resize(callArgCount);
+				for(size_t jj = 0; jj < callArgCount; ++jj){
+					const mxArray *arg = mxGetCell(call, jj + 1);
+					callArgs[jj] = (arg != nullptr) ? arg : emptyArg;
+				}
+				wrapper(callOutputCount, callOutputs.data(), static_cast<int>(callArgCount), callArgs.data());
+				if(callOutputCount <= 1){
+					mxSetCell(results, ii, callOutputs[0]);
+				}else{
+					mxArray *outputs = mxCreateCellMatrix(1, callOutputCount);
+					for(int jj = 0; jj < callOutputCount; ++jj){
+						mxSetCell(outputs, jj, callOutputs[jj]);
+					}
+					mxSetCell(results, ii, outputs);
+				}
+				mxSetField(status, ii, "identifier", mxCreateString(""));
+				mxSetField(status, ii, "message", mxCreateString(""));
+			} catch(const helicsMexCallError &e) {
+				for(mxArray *output : callOutputs){
+					if(output != nullptr){
+						mxDestroyArray(output);
+					}
+				}
+				mxSetField(status, ii, "identifier", mxCreateString(e.identifier.c_str()));
+				mxSetField(status, ii, "message", mxCreateString(e.message.c_str()));
+			}
+		}
+	}
+	mxDestroyArray(emptyArg);
+
+	resv[0] = results;
+	if(resc > 1){
+		resv[1] = status;
+	}else{
+		mxDestroyArray(status);
+	}
+}
+
+
@@ -0,0 +1,64 @@
+void _wrap_helicsMexObjects(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 0){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:__objects:rhs","This function requires 0 arguments.");
+	}
+
+	double counts[HELICS_MEX_OBJECT_TYPE_COUNT] = {};
+	for(auto &live : liveHelicsObjects){
+		counts[live.second.type] += 1.0;
+	}
+
+	mxArray *_out = mxCreateStructMatrix(1, 1, HELICS_MEX_OBJECT_TYPE_COUNT, helicsMexObjectTypeNames);
+	for(int type = 0; type < HELICS_MEX_OBJECT_TYPE_COUNT; ++type){
+		mxSetFieldByNumber(_out, 0, type, mxCreateDoubleScalar(counts[type]));
+	}
+	resv[0] = _out;
+}
+
+
+/* federates, cores and brokers are tracked themselves, interfaces through the federate or core that owns them */
+static bool isCallbackTargetLive(void *object) {
+	if(liveHelicsObjects.count(object) != 0){
+		return true;
+	}
+	void *owner = getInterfaceOwner(object);
+	return owner != nullptr && liveHelicsObjects.count(owner) != 0;
+}
+
+/* release everything the mex file holds on to when MATLAB unloads it, in dependency order */
+static void helicsMexAtExit() {
+	/* player threads use federates and queue callbacks so they are stopped first */
+	for(auto &player : players){
+		player.second->abort();
+	}
+	players.clear();
+	/* HELICS threads waiting on a callback return without it and later callbacks are dropped */
+	closeCallbackQueue();
+	/* freeing an object must not call back into MATLAB so the callbacks are cleared in HELICS first */
+	HelicsError err = helicsErrorInitialize();
+	for(helicsMexCallback *slot : matlabCallbacks){
+		if(slot->detach && isCallbackTargetLive(slot->object)){
+			slot->detach(&err);
+			helicsErrorClear(&err);
+		}
+	}
+	messagePools.clear();
+	pooledMessageOwners.clear();
+	freeHelicsObjects();
+	/* no callback can run any more so the handles and argument arrays go last */
+	clearMatlabCallbacks();
+	/* nothing left in HELICS points at the native callback data */
+	nativeFilterOperatorChains.clear();
+	retiredFilterOperatorChains.clear();
+	nativeTranslatorKernelSlots.clear();
+	loggingBuffers.clear();
+	retiredLoggingBuffers.clear();
+	{
+		std::lock_guard<std::mutex> guard(queryResponseLock);
+		queryResponses.clear();
+	}
+	inputDataTypeCache.clear();
+}
+
+
@@ -0,0 +1,211 @@
+/* a federate stepping through a table of publication values on its own thread */
+class helicsMexPlayer {
+public:
+	helicsMexPlayer(HelicsFederate federate, std::vector<HelicsPublication> publications, std::vector<double> stepTimes, std::vector<double> stepValues) :
+		fed(federate), pubs(std::move(publications)), times(std::move(stepTimes)), values(std::move(stepValues)) {
+		worker = std::thread([this](){ run(); });
+	}
+
+	~helicsMexPlayer() {
+		stop();
+		if(worker.joinable()){
+			worker.join();
+		}
+	}
+
+	void stop() {
+		stopRequested.store(true);
+	}
+
+	/* used when the mex file is unloaded, a time request blocked in HELICS is ended with a local error */
+	void abort() {
+		stop();
+		if(running.load()){
+			HelicsError err = helicsErrorInitialize();
+			helicsFederateLocalError(fed, HELICS_ERROR_USER_ABORT, "helicsMex is unloading", &err);
+		}
+	}
+
+	bool isRunning() const {
+		return running.load();
+	}
+
+	void join() {
+		if(worker.joinable()){
+			worker.join();
+		}
+	}
+
+	mxArray *status() {
+		const char *fields[] = {"running", "step", "time", "error"};
+		mxArray *out = mxCreateStructMatrix(1, 1, 4, fields);
+		mxSetFieldByNumber(out, 0, 0, mxCreateLogicalScalar(running.load()));
+		mxSetFieldByNumber(out, 0, 1, mxCreateDoubleScalar(static_cast<double>(completedSteps.load())));
+		mxSetFieldByNumber(out, 0, 2, mxCreateDoubleScalar(grantedTime.load()));
+		std::lock_guard<std::mutex> guard(errorLock);
+		mxSetFieldByNumber(out, 0, 3, mxCreateString(errorMessage.c_str()));
+		return out;
+	}
+
+private:
+	void run() {
+		size_t stepCount = times.size();
+		HelicsError err = helicsErrorInitialize();
+		for(size_t step = 0; step < stepCount && !stopRequested.load(); ++step){
+			HelicsTime granted = helicsFederateRequestTime(fed, times[step], &err);
+			if(err.error_code != HELICS_OK){
+				break;
+			}
+			grantedTime.store(granted);
+			/* values is column major with one row per step and one column per publication */
+			for(size_t ii = 0; ii < pubs.size() && err.error_code == HELICS_OK; ++ii){
+				helicsPublicationPublishDouble(pubs[ii], values[step + ii * stepCount], &err);
+			}
+			if(err.error_code != HELICS_OK){
+				break;
+			}
+			completedSteps.store(step + 1);
+		}
+		if(err.error_code != HELICS_OK){
+			std::lock_guard<std::mutex> guard(errorLock);
+			errorMessage = (err.message != nullptr) ? err.message : "unknown HELICS error";
+		}
+		running.store(false);
+		/* wake a MATLAB thread waiting for the player */
+		queueCallbackEvent([](){});
+	}
+
+	HelicsFederate fed;
+	std::vector<HelicsPublication> pubs;
+	std::vector<double> times;
+	std::vector<double> values;
+	std::atomic<bool> stopRequested{false};
+	std::atomic<bool> running{true};
+	std::atomic<size_t> completedSteps{0};
+	std::atomic<double> grantedTime{HELICS_TIME_INVALID};
+	std::mutex errorLock;
+	std::string errorMessage;
+	std::thread worker;
+};
+
+static std::unordered_map<int, std::unique_ptr<helicsMexPlayer>> players;
+static int lastPlayerId = 0;
+
+static std::unordered_map<int, std::unique_ptr<helicsMexPlayer>>::iterator getPlayer(const char *functionName, const mxArray *argv[]){
+	std::string errorId = std::string("MATLAB:") + functionName + ":TypeError";
+	if(!mxIsNumeric(argv[0]) || mxGetNumberOfElements(argv[0]) != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt(errorId.c_str(),"Argument 1 must be a scalar player id.");
+	}
+	auto player = players.find(static_cast<int>(mxGetScalar(argv[0])));
+	if(player == players.end()){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt(errorId.c_str(),"Argument 1 is not the id of a player that has not been waited for.");
+	}
+	return player;
+}
+
+void _wrap_helicsFederateRunPlayer(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 4){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateRunPlayer:rhs","This function requires 4 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateRunPlayer:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+
+	if(mxGetClassID(argv[1]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateRunPlayer:TypeError","Argument 2 must be a uint64 array of publications.");
+	}
+	if(!mxIsDouble(argv[2]) || mxIsComplex(argv[2])){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateRunPlayer:TypeError","Argument 3 must be a real double array of times.");
+	}
+	size_t pubCount = mxGetNumberOfElements(argv[1]);
+	size_t stepCount = mxGetNumberOfElements(argv[2]);
+	if(!mxIsDouble(argv[3]) || mxIsComplex(argv[3]) || mxGetM(argv[3]) != stepCount || mxGetN(argv[3]) != pubCount){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateRunPlayer:TypeError","Argument 4 must be a real double matrix with one row per time and one column per publication.");
+	}
+
+	const HelicsPublication *pPubs = static_cast<const HelicsPublication *>(mxGetData(argv[1]));
+	const double *pTimes = mxGetDoubles(argv[2]);
+	const double *pValues = mxGetDoubles(argv[3]);
+	/* the player keeps its own copy since MATLAB may free the arguments while it runs */
+	int id = ++lastPlayerId;
+	players[id].reset(new helicsMexPlayer(fed,
+		std::vector<HelicsPublication>(pPubs, pPubs + pubCount),
+		std::vector<double>(pTimes, pTimes + stepCount),
+		std::vector<double>(pValues, pValues + stepCount * pubCount)));
+
+	resv[0] = mxCreateDoubleScalar(static_cast<double>(id));
+}
+
+
+void _wrap_helicsPlayerStop(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsPlayerStop:rhs","This function requires 1 arguments.");
+	}
+
+	getPlayer("helicsPlayerStop", argv)->second->stop();
+}
+
+
+void _wrap_helicsPlayerGetStatus(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsPlayerGetStatus:rhs","This function requires 1 arguments.");
+	}
+
+	resv[0] = getPlayer("helicsPlayerGetStatus", argv)->second->status();
+}
+
+
+void _wrap_helicsPlayerWait(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 1 || argc > 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsPlayerWait:rhs","This function requires at least 1 arguments and at most 2 arguments.");
+	}
+
+	int id = getPlayer("helicsPlayerWait", argv)->first;
+
+	double timeout = -1.0;
+	if(argc > 1){
+		if(!mxIsNumeric(argv[1]) || mxGetNumberOfElements(argv[1]) != 1){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsPlayerWait:TypeError","Argument 2 must be a scalar timeout in milliseconds.");
+		}
+		timeout = mxGetScalar(argv[1]);
+	}
+
+	/* run the callbacks the player raises while waiting for it, the player is looked up again after each
+	   pump since a callback may have waited for it too */
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+	if(timeout >= 0.0){
+		deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(static_cast<long long>(timeout * 1000.0));
+	}
+	waitPumpingCallbacks([&](){
+		auto player = players.find(id);
+		return player == players.end() || !player->second->isRunning();
+	}, deadline);
+	auto player = players.find(id);
+	if(player == players.end()){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsPlayerWait:TypeError","The player was released by a callback while waiting for it.");
+	}
+
+	/* a finished player is released after its final status is returned */
+	bool finished = !player->second->isRunning();
+	resv[0] = player->second->status();
+	if(finished){
+		player->second->join();
+		players.erase(player);
+	}
+}
+
+
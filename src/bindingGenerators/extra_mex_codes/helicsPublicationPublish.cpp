@@ -0,0 +1,189 @@
+/* append a string to a JSON array under construction */
+static void appendJsonString(std::string &json, const char *value){
+	json.push_back('"');
+	for(const char *c = value; *c != '\0'; ++c){
+		switch(*c){
+		case '"':
+			json += "\\\"";
+			break;
+		case '\\':
+			json += "\\\\";
+			break;
+		case '\n':
+			json += "\\n";
+			break;
+		case '\r':
+			json += "\\r";
+			break;
+		case '\t':
+			json += "\\t";
+			break;
+		default:
+			if(static_cast<unsigned char>(*c) < 0x20){
+				/* JSON does not allow raw control characters in a string */
+				char escaped[8];
+				snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(*c)));
+				json += escaped;
+			}else{
+				json.push_back(*c);
+			}
+			break;
+		}
+	}
+	json.push_back('"');
+}
+
+/* publish an integer or logical array, scalars go out as HELICS integers and arrays as vectors */
+template<class T>
+static void publishIntegerArray(HelicsPublication pub, const mxArray *value, HelicsError *err){
+	const T *values = static_cast<const T *>(mxGetData(value));
+	size_t count = mxGetNumberOfElements(value);
+	if(count == 1){
+		helicsPublicationPublishInteger(pub, static_cast<int64_t>(values[0]), err);
+		return;
+	}
+	double *vectorValues = static_cast<double *>(marshalArena.allocate(count * sizeof(double)));
+	std::copy(values, values + count, vectorValues);
+	helicsPublicationPublishVector(pub, vectorValues, static_cast<int>(count), err);
+}
+
+void _wrap_helicsPublicationPublish(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 2){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsPublicationPublish:rhs","This function requires 2 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsPublicationPublish:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsPublication pub = *(static_cast<HelicsPublication*>(mxGetData(argv[0])));
+
+	const mxArray *value = argv[1];
+	size_t count = mxGetNumberOfElements(value);
+
+	HelicsError err = helicsErrorInitialize();
+
+	switch(mxGetClassID(value)){
+	case mxCHAR_CLASS:
+		if(count == 1){
+			helicsPublicationPublishChar(pub, static_cast<char>(mxGetChars(value)[0]), &err);
+		}else{
+			char *str = mxArrayToUTF8String(value);
+			helicsPublicationPublishString(pub, str, &err);
+			mxFree(str);
+		}
+		break;
+	case mxDOUBLE_CLASS:
+		if(mxIsComplex(value)){
+			if(count == 1){
+				const mxComplexDouble *cval = mxGetComplexDoubles(value);
+				helicsPublicationPublishComplex(pub, cval->real, cval->imag, &err);
+			}else{
+				helicsPublicationPublishComplexVector(pub, getInterleavedComplexData(value), static_cast<int>(count * 2), &err);
+			}
+		}else if(count == 1){
+			helicsPublicationPublishDouble(pub, mxGetDoubles(value)[0], &err);
+		}else{
+			helicsPublicationPublishVector(pub, mxGetDoubles(value), static_cast<int>(count), &err);
+		}
+		break;
+	case mxSINGLE_CLASS:
+		if(mxIsComplex(value)){
+			const mxComplexSingle *cvals = mxGetComplexSingles(value);
+			if(count == 1){
+				helicsPublicationPublishComplex(pub, cvals->real, cvals->imag, &err);
+			}else{
+				double *vectorValues = static_cast<double *>(marshalArena.allocate(2 * count * sizeof(double)));
+				for(size_t ii = 0; ii < count; ++ii){
+					vectorValues[2 * ii] = cvals[ii].real;
+					vectorValues[2 * ii + 1] = cvals[ii].imag;
+				}
+				helicsPublicationPublishComplexVector(pub, vectorValues, static_cast<int>(count * 2), &err);
+			}
+		}else{
+			const mxSingle *vals = mxGetSingles(value);
+			if(count == 1){
+				helicsPublicationPublishDouble(pub, vals[0], &err);
+			}else{
+				double *vectorValues = static_cast<double *>(marshalArena.allocate(count * sizeof(double)));
+				std::copy(vals, vals + count, vectorValues);
+				helicsPublicationPublishVector(pub, vectorValues, static_cast<int>(count), &err);
+			}
+		}
+		break;
+	case mxLOGICAL_CLASS:
+		if(count == 1){
+			helicsPublicationPublishBoolean(pub, mxGetLogicals(value)[0] ? HELICS_TRUE : HELICS_FALSE, &err);
+		}else{
+			publishIntegerArray<mxLogical>(pub, value, &err);
+		}
+		break;
+	case mxINT8_CLASS:
+		if(count == 1){
+			helicsPublicationPublishChar(pub, static_cast<char>(mxGetInt8s(value)[0]), &err);
+		}else{
+			publishIntegerArray<mxInt8>(pub, value, &err);
+		}
+		break;
+	case mxUINT8_CLASS:
+		publishIntegerArray<mxUint8>(pub, value, &err);
+		break;
+	case mxINT16_CLASS:
+		publishIntegerArray<mxInt16>(pub, value, &err);
+		break;
+	case mxUINT16_CLASS:
+		publishIntegerArray<mxUint16>(pub, value, &err);
+		break;
+	case mxINT32_CLASS:
+		publishIntegerArray<mxInt32>(pub, value, &err);
+		break;
+	case mxUINT32_CLASS:
+		publishIntegerArray<mxUint32>(pub, value, &err);
+		break;
+	case mxINT64_CLASS:
+		publishIntegerArray<mxInt64>(pub, value, &err);
+		break;
+	case mxUINT64_CLASS:
+		publishIntegerArray<mxUint64>(pub, value, &err);
+		break;
+	case mxCELL_CLASS:
+	{
+		/* {name, value} is a named point, any other cell must hold only strings and is sent as a JSON array */
+		const mxArray *first = (count > 0) ? mxGetCell(value, 0) : nullptr;
+		const mxArray *second = (count == 2) ? mxGetCell(value, 1) : nullptr;
+		if(first != nullptr && second != nullptr && mxIsChar(first) && mxIsNumeric(second) && !mxIsComplex(second) && mxGetNumberOfElements(second) == 1){
+			char *name = mxArrayToUTF8String(first);
+			helicsPublicationPublishNamedPoint(pub, name, mxGetScalar(second), &err);
+			mxFree(name);
+			break;
+		}
+		std::string json = "[";
+		for(size_t ii = 0; ii < count; ++ii){
+			const mxArray *cell = mxGetCell(value, ii);
+			if(cell == nullptr || !mxIsChar(cell)){
+				mexUnlock();
+				helicsMexErrMsgIdAndTxt("MATLAB:helicsPublicationPublish:TypeError","A cell array argument must be a {name, value} pair or contain only strings.");
+			}
+			if(ii > 0){
+				json.push_back(',');
+			}
+			char *str = mxArrayToUTF8String(cell);
+			appendJsonString(json, str);
+			mxFree(str);
+		}
+		json.push_back(']');
+		helicsPublicationPublishString(pub, json.c_str(), &err);
+		break;
+	}
+	default:
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsPublicationPublish:TypeError","Argument 2 must be a numeric, logical, char or cell array.");
+	}
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
@@ -0,0 +1,93 @@
+void _wrap_helicsFederateSetQueryResponse(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 3){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetQueryResponse:rhs","This function requires 3 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetQueryResponse:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+
+	if(!mxIsChar(argv[1])){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetQueryResponse:TypeError","Argument 2 must be a string.");
+	}
+	if(!mxIsEmpty(argv[2]) && !mxIsChar(argv[2]) && (!mxIsDouble(argv[2]) || mxIsComplex(argv[2]))){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateSetQueryResponse:TypeError","Argument 3 must be a string, a real double array or empty.");
+	}
+	char *queryString = mxArrayToUTF8String(argv[1]);
+	std::string query(queryString);
+	mxFree(queryString);
+
+	bool installCallback = false;
+	{
+		std::lock_guard<std::mutex> guard(queryResponseLock);
+		if(mxIsEmpty(argv[2])){
+			auto responses = queryResponses.find(fed);
+			if(responses != queryResponses.end()){
+				responses->second.erase(query);
+			}
+		}else{
+			auto responses = queryResponses.find(fed);
+			if(responses == queryResponses.end()){
+				responses = queryResponses.emplace(fed, std::unordered_map<std::string, helicsMexQueryResponse>()).first;
+				installCallback = true;
+			}
+			helicsMexQueryResponse &response = responses->second[query];
+			if(mxIsChar(argv[2])){
+				char *answer = mxArrayToUTF8String(argv[2]);
+				response.live = false;
+				response.answer = answer;
+				mxFree(answer);
+			}else{
+				const double *values = mxGetDoubles(argv[2]);
+				response.live = true;
+				response.values.assign(values, values + mxGetNumberOfElements(argv[2]));
+			}
+		}
+	}
+	if(!installCallback){
+		return;
+	}
+
+	/* a MATLAB query callback already answers from the table before calling MATLAB */
+	for(helicsMexCallback *slot : matlabCallbacks){
+		if(slot->object == fed && slot->rhs[0] != nullptr && std::strcmp(slot->setter, "helicsFederateSetQueryCallback") == 0){
+			return;
+		}
+	}
+
+	HelicsError err = helicsErrorInitialize();
+
+	helicsFederateSetQueryCallback(fed, &nativeQueryResponseCallback, fed, &err);
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
+void _wrap_helicsFederateClearQueryResponses(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateClearQueryResponses:rhs","This function requires 1 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsFederateClearQueryResponses:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsFederate fed = *(static_cast<HelicsFederate*>(mxGetData(argv[0])));
+
+	/* the installed query callback stays, with no answers it leaves every query to HELICS or the MATLAB callback */
+	std::lock_guard<std::mutex> guard(queryResponseLock);
+	auto responses = queryResponses.find(fed);
+	if(responses != queryResponses.end()){
+		responses->second.clear();
+	}
+}
+
+
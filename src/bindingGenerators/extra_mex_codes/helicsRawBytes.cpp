@@ -0,0 +1,55 @@
+void _wrap_helicsInputGetRawBytes(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsInputGetRawBytes:rhs","This function requires 1 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsInputGetRawBytes:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsInput ipt = *(static_cast<HelicsInput*>(mxGetData(argv[0])));
+
+	int maxDataLen = helicsInputGetByteCount(ipt);
+
+	mxArray *_out = mxCreateNumericMatrix(1, maxDataLen, mxUINT8_CLASS, mxREAL);
+
+	int actualSize = 0;
+
+	HelicsError err = helicsErrorInitialize();
+
+	helicsInputGetBytes(ipt, mxGetUint8s(_out), maxDataLen, &actualSize, &err);
+
+	if(err.error_code != HELICS_OK){
+		mxDestroyArray(_out);
+		throwHelicsMatlabError(&err);
+	}
+
+	mxSetN(_out, actualSize);
+	resv[0] = _out;
+}
+
+
+void _wrap_helicsMessageGetRawBytes(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc != 1){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsMessageGetRawBytes:rhs","This function requires 1 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsMessageGetRawBytes:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsMessage message = *(static_cast<HelicsMessage*>(mxGetData(argv[0])));
+
+	int messageLength = helicsMessageGetByteCount(message);
+
+	mxArray *_out = mxCreateUninitNumericMatrix(1, messageLength, mxUINT8_CLASS, mxREAL);
+	if(messageLength > 0){
+		memcpy(mxGetUint8s(_out), helicsMessageGetBytesPointer(message), messageLength);
+	}
+
+	resv[0] = _out;
+}
+
+
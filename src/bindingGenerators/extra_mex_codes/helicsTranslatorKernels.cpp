@@ -0,0 +1,353 @@
+/* value/message conversion run natively by a translator on a HELICS thread, it must not use the MATLAB API */
+class nativeTranslatorKernel {
+public:
+	virtual ~nativeTranslatorKernel() = default;
+	virtual void toMessage(HelicsDataBuffer value, HelicsMessage message) = 0;
+	virtual void toValue(HelicsMessage message, HelicsDataBuffer value) = 0;
+
+protected:
+	/* message payloads are not null terminated */
+	static std::string getPayload(HelicsMessage message) {
+		return std::string(static_cast<const char *>(helicsMessageGetBytesPointer(message)), static_cast<size_t>(helicsMessageGetByteCount(message)));
+	}
+
+	static void appendNumber(std::string &text, double value) {
+		char number[32];
+		snprintf(number, sizeof(number), "%.17g", value);
+		text += number;
+	}
+
+	void readVector(HelicsDataBuffer value) {
+		int maxLength = helicsDataBufferVectorSize(value);
+		int actualSize = 0;
+		vectorValues.resize(static_cast<size_t>(maxLength));
+		helicsDataBufferToVector(value, vectorValues.data(), maxLength, &actualSize);
+		vectorValues.resize(static_cast<size_t>(actualSize));
+	}
+
+	std::string text;
+	std::vector<double> vectorValues;
+};
+
+/* a double as a JSON object {"<key>":value}, a bare number is also accepted when converting back */
+class doubleJsonTranslatorKernel : public nativeTranslatorKernel {
+public:
+	explicit doubleJsonTranslatorKernel(std::string jsonKey) : key("\"" + jsonKey + "\"") {}
+
+	void toMessage(HelicsDataBuffer value, HelicsMessage message) override {
+		text = "{" + key + ":";
+		appendNumber(text, helicsDataBufferToDouble(value));
+		text += "}";
+		helicsMessageSetData(message, text.data(), static_cast<int>(text.size()), nullptr);
+	}
+
+	void toValue(HelicsMessage message, HelicsDataBuffer value) override {
+		text = getPayload(message);
+		size_t start = text.find(key);
+		start = (start == std::string::npos) ? 0 : text.find(':', start) + 1;
+		helicsDataBufferFillFromDouble(value, strtod(text.c_str() + start, nullptr));
+	}
+
+private:
+	std::string key;
+};
+
+/* a vector as a single line of separated values */
+class vectorCsvTranslatorKernel : public nativeTranslatorKernel {
+public:
+	explicit vectorCsvTranslatorKernel(char separator) : delimiter(separator) {}
+
+	void toMessage(HelicsDataBuffer value, HelicsMessage message) override {
+		readVector(value);
+		text.clear();
+		for(size_t ii = 0; ii < vectorValues.size(); ++ii){
+			if(ii > 0){
+				text.push_back(delimiter);
+			}
+			appendNumber(text, vectorValues[ii]);
+		}
+		helicsMessageSetData(message, text.data(), static_cast<int>(text.size()), nullptr);
+	}
+
+	void toValue(HelicsMessage message, HelicsDataBuffer value) override {
+		text = getPayload(message);
+		vectorValues.clear();
+		const char *position = text.c_str();
+		while(*position != '\0'){
+			char *end = nullptr;
+			double element = strtod(position, &end);
+			if(end == position){
+				break;
+			}
+			vectorValues.push_back(element);
+			position = end;
+			while(*position == delimiter || *position == ' ' || *position == '\r' || *position == '\n'){
+				++position;
+			}
+		}
+		helicsDataBufferFillFromVector(value, vectorValues.data(), static_cast<int>(vectorValues.size()));
+	}
+
+private:
+	char delimiter;
+};
+
+/* a named point as name<separator>value, the last separator splits the name from the value */
+class namedPointKeyValueTranslatorKernel : public nativeTranslatorKernel {
+public:
+	explicit namedPointKeyValueTranslatorKernel(std::string keyValueSeparator) : separator(std::move(keyValueSeparator)) {}
+
+	void toMessage(HelicsDataBuffer value, HelicsMessage message) override {
+		int maxStringLen = helicsDataBufferStringSize(value) + 2;
+		name.resize(static_cast<size_t>(maxStringLen));
+		int actualLength = 0;
+		double val = 0.0;
+		helicsDataBufferToNamedPoint(value, &name[0], maxStringLen, &actualLength, &val);
+		text.assign(name.c_str());
+		text += separator;
+		appendNumber(text, val);
+		helicsMessageSetData(message, text.data(), static_cast<int>(text.size()), nullptr);
+	}
+
+	void toValue(HelicsMessage message, HelicsDataBuffer value) override {
+		text = getPayload(message);
+		size_t split = text.rfind(separator);
+		if(split == std::string::npos){
+			helicsDataBufferFillFromNamedPoint(value, text.c_str(), 0.0);
+			return;
+		}
+		name.assign(text, 0, split);
+		helicsDataBufferFillFromNamedPoint(value, name.c_str(), strtod(text.c_str() + split + separator.size(), nullptr));
+	}
+
+private:
+	std::string separator;
+	std::string name;
+};
+
+/* a vector packed into a fixed binary layout, one layout character per element */
+class binaryPackTranslatorKernel : public nativeTranslatorKernel {
+public:
+	binaryPackTranslatorKernel(std::string fieldTypes, bool bigEndian) : layout(std::move(fieldTypes)), swapBytes(bigEndian != hostIsBigEndian()) {
+		for(char fieldType : layout){
+			packedSize += fieldSize(fieldType);
+		}
+	}
+
+	static size_t fieldSize(char fieldType) {
+		switch(fieldType){
+		case 'd': case 'q': case 'Q':
+			return 8;
+		case 'f': case 'i': case 'I':
+			return 4;
+		case 'h': case 'H':
+			return 2;
+		case 'b': case 'B':
+			return 1;
+		default:
+			return 0;
+		}
+	}
+
+	void toMessage(HelicsDataBuffer value, HelicsMessage message) override {
+		readVector(value);
+		bytes.assign(packedSize, 0);
+		unsigned char *field = bytes.data();
+		for(size_t ii = 0; ii < layout.size(); ++ii){
+			double element = (ii < vectorValues.size()) ? vectorValues[ii] : 0.0;
+			switch(layout[ii]){
+			case 'd': storeField(field, element); break;
+			case 'f': storeField(field, static_cast<float>(element)); break;
+			case 'q': storeField(field, static_cast<int64_t>(element)); break;
+			case 'Q': storeField(field, static_cast<uint64_t>(element)); break;
+			case 'i': storeField(field, static_cast<int32_t>(element)); break;
+			case 'I': storeField(field, static_cast<uint32_t>(element)); break;
+			case 'h': storeField(field, static_cast<int16_t>(element)); break;
+			case 'H': storeField(field, static_cast<uint16_t>(element)); break;
+			case 'b': storeField(field, static_cast<int8_t>(element)); break;
+			case 'B': storeField(field, static_cast<uint8_t>(element)); break;
+			}
+			field += fieldSize(layout[ii]);
+		}
+		helicsMessageSetData(message, bytes.data(), static_cast<int>(bytes.size()), nullptr);
+	}
+
+	void toValue(HelicsMessage message, HelicsDataBuffer value) override {
+		const unsigned char *field = static_cast<const unsigned char *>(helicsMessageGetBytesPointer(message));
+		size_t available = static_cast<size_t>(helicsMessageGetByteCount(message));
+		vectorValues.clear();
+		for(size_t ii = 0; ii < layout.size() && fieldSize(layout[ii]) <= available; ++ii){
+			switch(layout[ii]){
+			case 'd': vectorValues.push_back(loadField<double>(field)); break;
+			case 'f': vectorValues.push_back(loadField<float>(field)); break;
+			case 'q': vectorValues.push_back(static_cast<double>(loadField<int64_t>(field))); break;
+			case 'Q': vectorValues.push_back(static_cast<double>(loadField<uint64_t>(field))); break;
+			case 'i': vectorValues.push_back(loadField<int32_t>(field)); break;
+			case 'I': vectorValues.push_back(loadField<uint32_t>(field)); break;
+			case 'h': vectorValues.push_back(loadField<int16_t>(field)); break;
+			case 'H': vectorValues.push_back(loadField<uint16_t>(field)); break;
+			case 'b': vectorValues.push_back(loadField<int8_t>(field)); break;
+			case 'B': vectorValues.push_back(loadField<uint8_t>(field)); break;
+			}
+			field += fieldSize(layout[ii]);
+			available -= fieldSize(layout[ii]);
+		}
+		helicsDataBufferFillFromVector(value, vectorValues.data(), static_cast<int>(vectorValues.size()));
+	}
+
+private:
+	static bool hostIsBigEndian() {
+		const uint16_t probe = 1;
+		return *reinterpret_cast<const unsigned char *>(&probe) == 0;
+	}
+
+	template<class T>
+	void storeField(unsigned char *field, T element) {
+		memcpy(field, &element, sizeof(T));
+		if(swapBytes){
+			std::reverse(field, field + sizeof(T));
+		}
+	}
+
+	template<class T>
+	T loadField(const unsigned char *field) {
+		unsigned char raw[sizeof(T)];
+		memcpy(raw, field, sizeof(T));
+		if(swapBytes){
+			std::reverse(raw, raw + sizeof(T));
+		}
+		T element;
+		memcpy(&element, raw, sizeof(T));
+		return element;
+	}
+
+	std::string layout;
+	bool swapBytes;
+	size_t packedSize = 0;
+	std::vector<unsigned char> bytes;
+};
+
+/* the kernel of one translator, it can be swapped while HELICS holds a pointer to the slot */
+struct nativeTranslatorKernelSlot {
+	std::mutex lock;
+	std::unique_ptr<nativeTranslatorKernel> kernel;
+};
+
+/* slots are only freed when the mex file unloads, after the objects holding a pointer to them */
+static std::unordered_map<HelicsTranslator, std::unique_ptr<nativeTranslatorKernelSlot>> nativeTranslatorKernelSlots;
+
+static void nativeTranslatorToMessageCallback(HelicsDataBuffer value, HelicsMessage message, void *userData){
+	nativeTranslatorKernelSlot *slot = static_cast<nativeTranslatorKernelSlot *>(userData);
+	std::lock_guard<std::mutex> lock(slot->lock);
+	slot->kernel->toMessage(value, message);
+}
+
+static void nativeTranslatorToValueCallback(HelicsMessage message, HelicsDataBuffer value, void *userData){
+	nativeTranslatorKernelSlot *slot = static_cast<nativeTranslatorKernelSlot *>(userData);
+	std::lock_guard<std::mutex> lock(slot->lock);
+	slot->kernel->toValue(message, value);
+}
+
+static std::string getNativeTranslatorKernelString(const mxArray *params, const char *field, const char *defaultValue){
+	const mxArray *value = (params != nullptr) ? mxGetField(params, 0, field) : nullptr;
+	if(value == nullptr){
+		return defaultValue;
+	}
+	if(!mxIsChar(value)){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsTranslatorSetNativeKernel:TypeError", (std::string("Parameter '") + field + "' must be a string.").c_str());
+	}
+	char *str = mxArrayToUTF8String(value);
+	std::string result(str);
+	mxFree(str);
+	return result;
+}
+
+static std::unique_ptr<nativeTranslatorKernel> createNativeTranslatorKernel(const std::string &kernelName, const mxArray *params){
+	if(kernelName == "doubleJson"){
+		return std::unique_ptr<nativeTranslatorKernel>(new doubleJsonTranslatorKernel(getNativeTranslatorKernelString(params, "key", "value")));
+	}
+	if(kernelName == "vectorCsv"){
+		std::string separator = getNativeTranslatorKernelString(params, "separator", ",");
+		if(separator.size() != 1){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsTranslatorSetNativeKernel:TypeError","Parameter 'separator' must be a single character.");
+		}
+		return std::unique_ptr<nativeTranslatorKernel>(new vectorCsvTranslatorKernel(separator[0]));
+	}
+	if(kernelName == "namedPointKeyValue"){
+		std::string separator = getNativeTranslatorKernelString(params, "separator", "=");
+		if(separator.empty()){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsTranslatorSetNativeKernel:TypeError","Parameter 'separator' must not be empty.");
+		}
+		return std::unique_ptr<nativeTranslatorKernel>(new namedPointKeyValueTranslatorKernel(separator));
+	}
+	if(kernelName == "binaryPack"){
+		std::string layout = getNativeTranslatorKernelString(params, "layout", "");
+		bool bigEndian = false;
+		if(!layout.empty() && (layout[0] == '<' || layout[0] == '>')){
+			bigEndian = (layout[0] == '>');
+			layout.erase(0, 1);
+		}
+		if(layout.empty() || std::any_of(layout.begin(), layout.end(), [](char fieldType){ return binaryPackTranslatorKernel::fieldSize(fieldType) == 0; })){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsTranslatorSetNativeKernel:TypeError","Parameter 'layout' must be a string of the field types d, f, q, Q, i, I, h, H, b and B with an optional < or > byte order prefix.");
+		}
+		return std::unique_ptr<nativeTranslatorKernel>(new binaryPackTranslatorKernel(layout, bigEndian));
+	}
+	mexUnlock();
+	helicsMexErrMsgIdAndTxt("MATLAB:helicsTranslatorSetNativeKernel:TypeError", ("Unknown translator kernel '" + kernelName + "'.").c_str());
+	return nullptr;
+}
+
+void _wrap_helicsTranslatorSetNativeKernel(int resc, mxArray *resv[], int argc, const mxArray *argv[]){
+	if(argc < 2 || argc > 3){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsTranslatorSetNativeKernel:rhs","This function requires at least 2 arguments and at most 3 arguments.");
+	}
+
+	if(mxGetClassID(argv[0]) != mxUINT64_CLASS){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsTranslatorSetNativeKernel:TypeError","Argument 1 must be of type uint64.");
+	}
+	HelicsTranslator trans = *(static_cast<HelicsTranslator*>(mxGetData(argv[0])));
+
+	if(!mxIsChar(argv[1])){
+		mexUnlock();
+		helicsMexErrMsgIdAndTxt("MATLAB:helicsTranslatorSetNativeKernel:TypeError","Argument 2 must be a string.");
+	}
+	char *name = mxArrayToUTF8String(argv[1]);
+	std::string kernelName(name);
+	mxFree(name);
+
+	const mxArray *params = nullptr;
+	if(argc > 2 && !mxIsEmpty(argv[2])){
+		if(!mxIsStruct(argv[2]) || mxGetNumberOfElements(argv[2]) != 1){
+			mexUnlock();
+			helicsMexErrMsgIdAndTxt("MATLAB:helicsTranslatorSetNativeKernel:TypeError","Argument 3 must be a scalar struct of kernel parameters.");
+		}
+		params = argv[2];
+	}
+
+	std::unique_ptr<nativeTranslatorKernel> kernel = createNativeTranslatorKernel(kernelName, params);
+
+	HelicsError err = helicsErrorInitialize();
+
+	auto slot = nativeTranslatorKernelSlots.find(trans);
+	if(slot == nativeTranslatorKernelSlots.end()){
+		slot = nativeTranslatorKernelSlots.emplace(trans, std::unique_ptr<nativeTranslatorKernelSlot>(new nativeTranslatorKernelSlot)).first;
+	}
+	{
+		std::lock_guard<std::mutex> lock(slot->second->lock);
+		slot->second->kernel = std::move(kernel);
+	}
+	/* installed every time since a MATLAB callback may have replaced the native one */
+	helicsTranslatorSetCustomCallback(trans, &nativeTranslatorToMessageCallback, &nativeTranslatorToValueCallback, slot->second.get(), &err);
+
+	if(err.error_code != HELICS_OK){
+		throwHelicsMatlabError(&err);
+	}
+}
+
+
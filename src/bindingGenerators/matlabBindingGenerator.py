@@ -61,10 +61,146 @@ class MatlabBindingGenerator(object):
             for h in headerFiles:
                 boilerPlateStr = f"#include \"helics/helics.h\"\n"
             boilerPlateStr += "#include <mex.h>\n"
+            boilerPlateStr += "#include <algorithm>\n"
+            boilerPlateStr += "#include <atomic>\n"
+            boilerPlateStr += "#include <chrono>\n"
+            boilerPlateStr += "#include <condition_variable>\n"
+            boilerPlateStr += "#include <cstdio>\n"
+            boilerPlateStr += "#include <cstdlib>\n"
+            boilerPlateStr += "#include <cstring>\n"
+            boilerPlateStr += "#include <functional>\n"
+            boilerPlateStr += "#include <future>\n"
+            boilerPlateStr += "#include <initializer_list>\n"
+            boilerPlateStr += "#include <limits>\n"
+            boilerPlateStr += "#include <memory>\n"
+            boilerPlateStr += "#include <mutex>\n"
+            boilerPlateStr += "#include <random>\n"
+            boilerPlateStr += "#include <regex>\n"
             boilerPlateStr += "#include <stdexcept>\n"
             boilerPlateStr += "#include <string>\n"
-            boilerPlateStr += "#include <unordered_map>\n\n"
+            boilerPlateStr += "#include <thread>\n"
+            boilerPlateStr += "#include <unordered_map>\n"
+            boilerPlateStr += "#include <unordered_set>\n"
+            boilerPlateStr += "#include <vector>\n\n"
             boilerPlateStr += "static int mexFunctionCalled = 0;\n\n"
+            boilerPlateStr += "typedef void (*wrapperFunction)(int resc, mxArray *resv[], int argc, const mxArray *argv[]);\n\n"
+            boilerPlateStr += "/* error raised by a wrapper function while it runs as part of a batch */\n"
+            boilerPlateStr += "struct helicsMexCallError {\n"
+            boilerPlateStr += "\tstd::string identifier;\n"
+            boilerPlateStr += "\tstd::string message;\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "/* number of active mexFunction calls, greater than 1 while helicsMex is called from a callback */\n"
+            boilerPlateStr += "static int mexCallDepth = 0;\n\n"
+            boilerPlateStr += "struct mexCallDepthGuard {\n"
+            boilerPlateStr += "\tmexCallDepthGuard() { ++mexCallDepth; }\n"
+            boilerPlateStr += "\t~mexCallDepthGuard() { --mexCallDepth; }\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "/* mexCallDepth of the running helicsMex('__batch',...) call, 0 if there is none, wrapper errors at that depth\n"
+            boilerPlateStr += "   are reported per call instead of aborting the batch while errors in callbacks it triggers are raised as usual */\n"
+            boilerPlateStr += "static int batchCallDepth = 0;\n\n"
+            boilerPlateStr += "static void helicsMexErrMsgIdAndTxt(const char *identifier, const char *message) {\n"
+            boilerPlateStr += "\tif(batchCallDepth != 0 && batchCallDepth == mexCallDepth){\n"
+            boilerPlateStr += "\t\tthrow helicsMexCallError{identifier, message};\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tmexErrMsgIdAndTxt(identifier, \"%s\", message);\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* bump allocator for the scratch buffers used to marshal arguments and results */\n"
+            boilerPlateStr += "class helicsMexArena {\n"
+            boilerPlateStr += "public:\n"
+            boilerPlateStr += "\tvoid *allocate(size_t size) {\n"
+            boilerPlateStr += "\t\tsize = (size + alignment - 1) & ~(alignment - 1);\n"
+            boilerPlateStr += "\t\twhile(current < blocks.size() && blocks[current].used + size > blocks[current].size){\n"
+            boilerPlateStr += "\t\t\t++current;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tif(current == blocks.size()){\n"
+            boilerPlateStr += "\t\t\tsize_t blockSize = std::max(size, minimumBlockSize);\n"
+            boilerPlateStr += "\t\t\tblocks.push_back(arenaBlock{std::unique_ptr<char[]>(new char[blockSize]), blockSize, 0});\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tarenaBlock &block = blocks[current];\n"
+            boilerPlateStr += "\t\tvoid *ptr = block.data.get() + block.used;\n"
+            boilerPlateStr += "\t\tblock.used += size;\n"
+            boilerPlateStr += "\t\treturn ptr;\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\t/* release everything handed out, multiple blocks are merged into one so the next call does not need to allocate */\n"
+            boilerPlateStr += "\tvoid reset() {\n"
+            boilerPlateStr += "\t\tif(blocks.size() > 1){\n"
+            boilerPlateStr += "\t\t\tsize_t totalSize = 0;\n"
+            boilerPlateStr += "\t\t\tfor(const arenaBlock &block : blocks){\n"
+            boilerPlateStr += "\t\t\t\ttotalSize += block.size;\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t\tblocks.clear();\n"
+            boilerPlateStr += "\t\t\tblocks.push_back(arenaBlock{std::unique_ptr<char[]>(new char[totalSize]), totalSize, 0});\n"
+            boilerPlateStr += "\t\t}else if(!blocks.empty()){\n"
+            boilerPlateStr += "\t\t\tblocks[0].used = 0;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tcurrent = 0;\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "private:\n"
+            boilerPlateStr += "\tstruct arenaBlock {\n"
+            boilerPlateStr += "\t\tstd::unique_ptr<char[]> data;\n"
+            boilerPlateStr += "\t\tsize_t size;\n"
+            boilerPlateStr += "\t\tsize_t used;\n"
+            boilerPlateStr += "\t};\n"
+            boilerPlateStr += "\tstatic constexpr size_t alignment = 16;\n"
+            boilerPlateStr += "\tstatic constexpr size_t minimumBlockSize = 64 * 1024;\n"
+            boilerPlateStr += "\tstd::vector<arenaBlock> blocks;\n"
+            boilerPlateStr += "\tsize_t current = 0;\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "/* memory from the arena is valid until the outermost mexFunction call returns */\n"
+            boilerPlateStr += "static helicsMexArena marshalArena;\n\n"
+            boilerPlateStr += "/* returns alternating real/imag values for a double array, complex arrays are passed through without a copy */\n"
+            boilerPlateStr += "static const double *getInterleavedComplexData(const mxArray *values) {\n"
+            boilerPlateStr += "\tif(mxIsComplex(values)){\n"
+            boilerPlateStr += "\t\treturn reinterpret_cast<const double *>(mxGetComplexDoubles(values));\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tsize_t count = mxGetNumberOfElements(values);\n"
+            boilerPlateStr += "\tconst mxDouble *realValues = mxGetDoubles(values);\n"
+            boilerPlateStr += "\tdouble *interleaved = static_cast<double *>(marshalArena.allocate(2 * count * sizeof(double)));\n"
+            boilerPlateStr += "\tfor(size_t ii = 0; ii < count; ++ii){\n"
+            boilerPlateStr += "\t\tinterleaved[2 * ii] = realValues[ii];\n"
+            boilerPlateStr += "\t\tinterleaved[2 * ii + 1] = 0.0;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\treturn interleaved;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* returns the bytes of a char or uint8 array, uint8 arrays are passed through without a copy and chars are encoded as UTF-8,\n"
+            boilerPlateStr += "   unpaired surrogates become U+FFFD and embedded nulls are kept */\n"
+            boilerPlateStr += "static const void *getBytePayload(const mxArray *value, int *length) {\n"
+            boilerPlateStr += "\tsize_t count = mxGetNumberOfElements(value);\n"
+            boilerPlateStr += "\tif(!mxIsChar(value)){\n"
+            boilerPlateStr += "\t\t*length = static_cast<int>(count);\n"
+            boilerPlateStr += "\t\treturn mxGetUint8s(value);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tconst mxChar *chars = mxGetChars(value);\n"
+            boilerPlateStr += "\t/* a UTF-16 unit takes at most 3 bytes, a surrogate pair 4 bytes for 2 units */\n"
+            boilerPlateStr += "\tchar *bytes = static_cast<char *>(marshalArena.allocate(3 * count));\n"
+            boilerPlateStr += "\tsize_t used = 0;\n"
+            boilerPlateStr += "\tfor(size_t ii = 0; ii < count; ++ii){\n"
+            boilerPlateStr += "\t\tunsigned int code = chars[ii];\n"
+            boilerPlateStr += "\t\tif(code >= 0xD800 && code <= 0xDBFF && ii + 1 < count && chars[ii + 1] >= 0xDC00 && chars[ii + 1] <= 0xDFFF){\n"
+            boilerPlateStr += "\t\t\tcode = 0x10000 + ((code - 0xD800) << 10) + (chars[ii + 1] - 0xDC00);\n"
+            boilerPlateStr += "\t\t\t++ii;\n"
+            boilerPlateStr += "\t\t}else if(code >= 0xD800 && code <= 0xDFFF){\n"
+            boilerPlateStr += "\t\t\tcode = 0xFFFD;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tif(code < 0x80){\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(code);\n"
+            boilerPlateStr += "\t\t}else if(code < 0x800){\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(0xC0 | (code >> 6));\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(0x80 | (code & 0x3F));\n"
+            boilerPlateStr += "\t\t}else if(code < 0x10000){\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(0xE0 | (code >> 12));\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(0x80 | (code & 0x3F));\n"
+            boilerPlateStr += "\t\t}else{\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(0xF0 | (code >> 18));\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(0x80 | ((code >> 12) & 0x3F));\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));\n"
+            boilerPlateStr += "\t\t\tbytes[used++] = static_cast<char>(0x80 | (code & 0x3F));\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\t*length = static_cast<int>(used);\n"
+            boilerPlateStr += "\treturn bytes;\n"
+            boilerPlateStr += "}\n\n"
             boilerPlateStr += "static void throwHelicsMatlabError(HelicsError *err) {\n"
             boilerPlateStr += "\tmexUnlock();\n"
             boilerPlateStr += "\tswitch (err->error_code)\n"
@@ -72,42 +208,868 @@ class MatlabBindingGenerator(object):
             boilerPlateStr += "\tcase HELICS_OK:\n"
             boilerPlateStr += "\t\treturn;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_REGISTRATION_FAILURE:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:registration_failure\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:registration_failure\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_CONNECTION_FAILURE:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:connection_failure\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:connection_failure\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_INVALID_OBJECT:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:invalid_object\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:invalid_object\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_INVALID_ARGUMENT:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:invalid_argument\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:invalid_argument\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_DISCARD:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:discard\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:discard\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_SYSTEM_FAILURE:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:system_failure\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:system_failure\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_INVALID_STATE_TRANSITION:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:invalid_state_transition\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:invalid_state_transition\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_INVALID_FUNCTION_CALL:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:invalid_function_call\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:invalid_function_call\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_EXECUTION_FAILURE:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:execution_failure\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:execution_failure\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_INSUFFICIENT_SPACE:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:insufficient_space\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:insufficient_space\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\tcase HELICS_ERROR_OTHER:\n"
             boilerPlateStr += "\tcase HELICS_ERROR_EXTERNAL_TYPE:\n"
             boilerPlateStr += "\tdefault:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:error\", err->message);\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:error\", err->message);\n"
             boilerPlateStr += "\t\tbreak;\n"
             boilerPlateStr += "\t}\n"
             boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* a HELICS thread waiting for a queued callback, whichever of it and the MATLAB thread claims the call first decides\n"
+            boilerPlateStr += "   whether the callback runs or is skipped after the HELICS thread stopped waiting */\n"
+            boilerPlateStr += "struct helicsMexCallbackWaiter {\n"
+            boilerPlateStr += "\tstd::promise<void> completion;\n"
+            boilerPlateStr += "\tstd::atomic<bool> claimed{false};\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "/* callback raised on a HELICS thread, queued until the MATLAB thread drains it */\n"
+            boilerPlateStr += "struct helicsMexCallbackEvent {\n"
+            boilerPlateStr += "\tstd::atomic<helicsMexCallbackEvent *> next{nullptr};\n"
+            boilerPlateStr += "\tstd::function<void()> call;\n"
+            boilerPlateStr += "\tstd::shared_ptr<helicsMexCallbackWaiter> waiter;\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "/* intrusive lock-free queue with many producers (HELICS threads) and a single consumer (the MATLAB thread) */\n"
+            boilerPlateStr += "class helicsMexCallbackQueue {\n"
+            boilerPlateStr += "public:\n"
+            boilerPlateStr += "\thelicsMexCallbackQueue() : head(&stub), tail(&stub) {}\n\n"
+            boilerPlateStr += "\tvoid push(helicsMexCallbackEvent *event) {\n"
+            boilerPlateStr += "\t\tlink(event);\n"
+            boilerPlateStr += "\t\tpending.fetch_add(1);\n"
+            boilerPlateStr += "\t\t/* the mutex is only taken while the consumer sleeps, it is then either still checking pending or already waiting */\n"
+            boilerPlateStr += "\t\tif(sleeping.load()){\n"
+            boilerPlateStr += "\t\t\tstd::lock_guard<std::mutex> lock(wakeupMutex);\n"
+            boilerPlateStr += "\t\t\twakeup.notify_one();\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\t/* returns nullptr when the queue is empty or a producer is still linking its event */\n"
+            boilerPlateStr += "\thelicsMexCallbackEvent *pop() {\n"
+            boilerPlateStr += "\t\thelicsMexCallbackEvent *first = tail;\n"
+            boilerPlateStr += "\t\thelicsMexCallbackEvent *next = first->next.load(std::memory_order_acquire);\n"
+            boilerPlateStr += "\t\tif(first == &stub){\n"
+            boilerPlateStr += "\t\t\tif(next == nullptr){\n"
+            boilerPlateStr += "\t\t\t\treturn nullptr;\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t\ttail = next;\n"
+            boilerPlateStr += "\t\t\tfirst = next;\n"
+            boilerPlateStr += "\t\t\tnext = next->next.load(std::memory_order_acquire);\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tif(next == nullptr){\n"
+            boilerPlateStr += "\t\t\tif(first != head.load(std::memory_order_acquire)){\n"
+            boilerPlateStr += "\t\t\t\treturn nullptr;\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t\tlink(&stub);\n"
+            boilerPlateStr += "\t\t\tnext = first->next.load(std::memory_order_acquire);\n"
+            boilerPlateStr += "\t\t\tif(next == nullptr){\n"
+            boilerPlateStr += "\t\t\t\treturn nullptr;\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\ttail = next;\n"
+            boilerPlateStr += "\t\tpending.fetch_sub(1, std::memory_order_relaxed);\n"
+            boilerPlateStr += "\t\treturn first;\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\t/* block the MATLAB thread until an event is pushed or the deadline passes, time_point::max() waits for an event */\n"
+            boilerPlateStr += "\tvoid waitForEvents(std::chrono::steady_clock::time_point deadline) {\n"
+            boilerPlateStr += "\t\tstd::unique_lock<std::mutex> lock(wakeupMutex);\n"
+            boilerPlateStr += "\t\tsleeping.store(true);\n"
+            boilerPlateStr += "\t\tif(deadline == std::chrono::steady_clock::time_point::max()){\n"
+            boilerPlateStr += "\t\t\twakeup.wait(lock, [this]{ return pending.load() > 0; });\n"
+            boilerPlateStr += "\t\t}else{\n"
+            boilerPlateStr += "\t\t\twakeup.wait_until(lock, deadline, [this]{ return pending.load() > 0; });\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tsleeping.store(false);\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "private:\n"
+            boilerPlateStr += "\tvoid link(helicsMexCallbackEvent *event) {\n"
+            boilerPlateStr += "\t\tevent->next.store(nullptr, std::memory_order_relaxed);\n"
+            boilerPlateStr += "\t\thelicsMexCallbackEvent *previous = head.exchange(event, std::memory_order_acq_rel);\n"
+            boilerPlateStr += "\t\tprevious->next.store(event, std::memory_order_release);\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\thelicsMexCallbackEvent stub;\n"
+            boilerPlateStr += "\tstd::atomic<helicsMexCallbackEvent *> head;\n"
+            boilerPlateStr += "\thelicsMexCallbackEvent *tail;\n"
+            boilerPlateStr += "\tstd::atomic<int> pending{0};\n"
+            boilerPlateStr += "\tstd::atomic<bool> sleeping{false};\n"
+            boilerPlateStr += "\tstd::mutex wakeupMutex;\n"
+            boilerPlateStr += "\tstd::condition_variable wakeup;\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "static helicsMexCallbackQueue callbackQueue;\n\n"
+            boilerPlateStr += "/* the first mexFunction call fixes the MATLAB thread, mexCallMATLAB may only be used from it */\n"
+            boilerPlateStr += "static bool onMatlabThread() {\n"
+            boilerPlateStr += "\tstatic const std::thread::id matlabThreadId = std::this_thread::get_id();\n"
+            boilerPlateStr += "\treturn std::this_thread::get_id() == matlabThreadId;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* set when the mex file is unloaded, callbacks raised after that are dropped */\n"
+            boilerPlateStr += "static std::atomic<bool> callbackQueueClosed{false};\n"
+            boilerPlateStr += "/* HELICS threads between checking callbackQueueClosed and pushing their event */\n"
+            boilerPlateStr += "static std::atomic<int> callbackProducers{0};\n\n"
+            boilerPlateStr += "/* push an event unless the queue is closed, returns false if the event was not pushed */\n"
+            boilerPlateStr += "static bool pushCallbackEvent(helicsMexCallbackEvent *event) {\n"
+            boilerPlateStr += "\t++callbackProducers;\n"
+            boilerPlateStr += "\tbool open = !callbackQueueClosed;\n"
+            boilerPlateStr += "\tif(open){\n"
+            boilerPlateStr += "\t\tcallbackQueue.push(event);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\t--callbackProducers;\n"
+            boilerPlateStr += "\treturn open;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* queue a callback that does not return anything to HELICS, the arguments must be captured by value */\n"
+            boilerPlateStr += "static void queueCallbackEvent(std::function<void()> call) {\n"
+            boilerPlateStr += "\thelicsMexCallbackEvent *event = new helicsMexCallbackEvent;\n"
+            boilerPlateStr += "\tevent->call = std::move(call);\n"
+            boilerPlateStr += "\tif(!pushCallbackEvent(event)){\n"
+            boilerPlateStr += "\t\tdelete event;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* milliseconds a HELICS thread waits for MATLAB to start a callback that returns a value, negative waits forever,\n"
+            boilerPlateStr += "   MATLAB only runs callbacks while it is inside a helicsMex call that waits so the wait is bounded by default */\n"
+            boilerPlateStr += "static std::atomic<int> callbackReturnTimeout{10000};\n\n"
+            boilerPlateStr += "/* queue a callback and block the HELICS thread until the MATLAB thread has run it, returns false if MATLAB did not\n"
+            boilerPlateStr += "   start it within callbackReturnTimeout, it is then skipped and HELICS gets the result the caller set up */\n"
+            boilerPlateStr += "static bool runCallbackOnMatlabThread(std::function<void()> call) {\n"
+            boilerPlateStr += "\tstd::shared_ptr<helicsMexCallbackWaiter> waiter = std::make_shared<helicsMexCallbackWaiter>();\n"
+            boilerPlateStr += "\tstd::future<void> done = waiter->completion.get_future();\n"
+            boilerPlateStr += "\thelicsMexCallbackEvent *event = new helicsMexCallbackEvent;\n"
+            boilerPlateStr += "\tevent->call = std::move(call);\n"
+            boilerPlateStr += "\tevent->waiter = waiter;\n"
+            boilerPlateStr += "\tif(!pushCallbackEvent(event)){\n"
+            boilerPlateStr += "\t\tdelete event;\n"
+            boilerPlateStr += "\t\treturn true;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tint timeout = callbackReturnTimeout.load();\n"
+            boilerPlateStr += "\tif(timeout >= 0 && done.wait_for(std::chrono::milliseconds(timeout)) == std::future_status::timeout && !waiter->claimed.exchange(true)){\n"
+            boilerPlateStr += "\t\treturn false;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tdone.wait();\n"
+            boilerPlateStr += "\treturn true;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* completes and frees an event even when its MATLAB callback raises an error */\n"
+            boilerPlateStr += "struct callbackEventGuard {\n"
+            boilerPlateStr += "\thelicsMexCallbackEvent *event;\n"
+            boilerPlateStr += "\t~callbackEventGuard() {\n"
+            boilerPlateStr += "\t\tif(event->waiter != nullptr){\n"
+            boilerPlateStr += "\t\t\tevent->waiter->completion.set_value();\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tdelete event;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "/* stop queueing callbacks and drop the queued ones, HELICS threads waiting on a callback return without it */\n"
+            boilerPlateStr += "static void closeCallbackQueue() {\n"
+            boilerPlateStr += "\tcallbackQueueClosed = true;\n"
+            boilerPlateStr += "\twhile(callbackProducers != 0){\n"
+            boilerPlateStr += "\t\tstd::this_thread::yield();\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\twhile(helicsMexCallbackEvent *event = callbackQueue.pop()){\n"
+            boilerPlateStr += "\t\tcallbackEventGuard guard{event};\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* run every queued callback on the MATLAB thread, returns the number of callbacks run */\n"
+            boilerPlateStr += "static int pumpCallbackEvents() {\n"
+            boilerPlateStr += "\tint count = 0;\n"
+            boilerPlateStr += "\twhile(helicsMexCallbackEvent *event = callbackQueue.pop()){\n"
+            boilerPlateStr += "\t\tcallbackEventGuard guard{event};\n"
+            boilerPlateStr += "\t\t/* the HELICS thread has stopped waiting and the arguments it passed are gone */\n"
+            boilerPlateStr += "\t\tif(event->waiter != nullptr && event->waiter->claimed.exchange(true)){\n"
+            boilerPlateStr += "\t\t\tcontinue;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\t++count;\n"
+            boilerPlateStr += "\t\tevent->call();\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\treturn count;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* first error raised by a MATLAB callback and the mexCallDepth of the helicsMex call that ran it, the error is raised\n"
+            boilerPlateStr += "   when that call returns so it never unwinds through HELICS or through a wait with an async operation outstanding */\n"
+            boilerPlateStr += "static helicsMexCallError deferredCallbackError;\n"
+            boilerPlateStr += "static int deferredCallbackErrorDepth = 0;\n\n"
+            boilerPlateStr += "static void deferCallbackError(const char *identifier, const char *message) {\n"
+            boilerPlateStr += "\tif(deferredCallbackErrorDepth == 0){\n"
+            boilerPlateStr += "\t\tdeferredCallbackError = helicsMexCallError{identifier, message};\n"
+            boilerPlateStr += "\t\tdeferredCallbackErrorDepth = mexCallDepth;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* mexCallMATLAB for callbacks, returns non zero and defers the error if the MATLAB function raises one */\n"
+            boilerPlateStr += "static int callMatlabFunction(int nlhs, mxArray *lhs[], int nrhs, mxArray *rhs[]) {\n"
+            boilerPlateStr += "\tmxArray *exception = mexCallMATLABWithTrap(nlhs, lhs, nrhs, rhs, \"feval\");\n"
+            boilerPlateStr += "\tif(exception == nullptr){\n"
+            boilerPlateStr += "\t\treturn 0;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tchar *identifier = mxArrayToString(mxGetProperty(exception, 0, \"identifier\"));\n"
+            boilerPlateStr += "\tchar *message = mxArrayToString(mxGetProperty(exception, 0, \"message\"));\n"
+            boilerPlateStr += "\tdeferCallbackError((identifier != nullptr) ? identifier : \"\", (message != nullptr) ? message : \"\");\n"
+            boilerPlateStr += "\tmxFree(identifier);\n"
+            boilerPlateStr += "\tmxFree(message);\n"
+            boilerPlateStr += "\tmxDestroyArray(exception);\n"
+            boilerPlateStr += "\treturn 1;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* raise the error deferred by a callback that ran during the current helicsMex call */\n"
+            boilerPlateStr += "static void raiseDeferredCallbackError() {\n"
+            boilerPlateStr += "\tif(deferredCallbackErrorDepth != 0 && deferredCallbackErrorDepth == mexCallDepth){\n"
+            boilerPlateStr += "\t\tdeferredCallbackErrorDepth = 0;\n"
+            boilerPlateStr += "\t\tmexUnlock();\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt(deferredCallbackError.identifier.c_str(), deferredCallbackError.message.c_str());\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* run queued callbacks on the MATLAB thread until completed returns true or the deadline passes, the callbacks and\n"
+            boilerPlateStr += "   threads the predicate depends on push an event when its result changes so the MATLAB thread sleeps in between */\n"
+            boilerPlateStr += "static void waitPumpingCallbacks(const std::function<bool()> &completed, std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max()) {\n"
+            boilerPlateStr += "\tpumpCallbackEvents();\n"
+            boilerPlateStr += "\twhile(!completed() && std::chrono::steady_clock::now() < deadline){\n"
+            boilerPlateStr += "\t\tcallbackQueue.waitForEvents(deadline);\n"
+            boilerPlateStr += "\t\tpumpCallbackEvents();\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* a thread that makes the blocking HELICS calls of one federate, core, broker or query for the MATLAB thread,\n"
+            boilerPlateStr += "   it is kept for the next call and pushes an event to wake the MATLAB thread when a call returns */\n"
+            boilerPlateStr += "class helicsMexHelperThread {\n"
+            boilerPlateStr += "public:\n"
+            boilerPlateStr += "\thelicsMexHelperThread() : state(std::make_shared<helperState>()) {\n"
+            boilerPlateStr += "\t\tstd::shared_ptr<helperState> shared = state;\n"
+            boilerPlateStr += "\t\tworker = std::thread([shared](){ run(*shared); });\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\t/* a call still blocked in HELICS cannot be interrupted so its thread is left to finish on its own */\n"
+            boilerPlateStr += "\t~helicsMexHelperThread() {\n"
+            boilerPlateStr += "\t\t{\n"
+            boilerPlateStr += "\t\t\tstd::lock_guard<std::mutex> guard(state->lock);\n"
+            boilerPlateStr += "\t\t\tstate->stopping = true;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tstate->wakeup.notify_one();\n"
+            boilerPlateStr += "\t\tif(state->busy.load()){\n"
+            boilerPlateStr += "\t\t\tworker.detach();\n"
+            boilerPlateStr += "\t\t}else{\n"
+            boilerPlateStr += "\t\t\tworker.join();\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\tbool idle() const {\n"
+            boilerPlateStr += "\t\treturn !state->busy.load();\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\t/* the helper must be idle, anything the call refers to has to stay valid until it is idle again */\n"
+            boilerPlateStr += "\tvoid start(std::function<void()> call) {\n"
+            boilerPlateStr += "\t\t{\n"
+            boilerPlateStr += "\t\t\tstd::lock_guard<std::mutex> guard(state->lock);\n"
+            boilerPlateStr += "\t\t\tstate->call = std::move(call);\n"
+            boilerPlateStr += "\t\t\tstate->busy.store(true);\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tstate->wakeup.notify_one();\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "private:\n"
+            boilerPlateStr += "\tstruct helperState {\n"
+            boilerPlateStr += "\t\tstd::mutex lock;\n"
+            boilerPlateStr += "\t\tstd::condition_variable wakeup;\n"
+            boilerPlateStr += "\t\tstd::function<void()> call;\n"
+            boilerPlateStr += "\t\tstd::atomic<bool> busy{false};\n"
+            boilerPlateStr += "\t\tbool stopping = false;\n"
+            boilerPlateStr += "\t};\n\n"
+            boilerPlateStr += "\tstatic void run(helperState &shared) {\n"
+            boilerPlateStr += "\t\tstd::unique_lock<std::mutex> lock(shared.lock);\n"
+            boilerPlateStr += "\t\twhile(true){\n"
+            boilerPlateStr += "\t\t\tshared.wakeup.wait(lock, [&](){ return shared.stopping || shared.call; });\n"
+            boilerPlateStr += "\t\t\tif(!shared.call){\n"
+            boilerPlateStr += "\t\t\t\treturn;\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t\tstd::function<void()> call = std::move(shared.call);\n"
+            boilerPlateStr += "\t\t\tshared.call = nullptr;\n"
+            boilerPlateStr += "\t\t\tlock.unlock();\n"
+            boilerPlateStr += "\t\t\tcall();\n"
+            boilerPlateStr += "\t\t\tlock.lock();\n"
+            boilerPlateStr += "\t\t\tshared.busy.store(false);\n"
+            boilerPlateStr += "\t\t\tqueueCallbackEvent([](){});\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\tstd::shared_ptr<helperState> state;\n"
+            boilerPlateStr += "\tstd::thread worker;\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "static std::unordered_map<void *, std::shared_ptr<helicsMexHelperThread>> helperThreads;\n\n"
+            boilerPlateStr += "static std::shared_ptr<helicsMexHelperThread> getHelperThread(void *object) {\n"
+            boilerPlateStr += "\tstd::shared_ptr<helicsMexHelperThread> &helper = helperThreads[object];\n"
+            boilerPlateStr += "\tif(helper == nullptr){\n"
+            boilerPlateStr += "\t\thelper = std::make_shared<helicsMexHelperThread>();\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\treturn helper;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* wait until the helper of an object, if it has one, has returned from its call */\n"
+            boilerPlateStr += "static void waitForHelperThread(void *object) {\n"
+            boilerPlateStr += "\tauto existing = helperThreads.find(object);\n"
+            boilerPlateStr += "\tif(existing != helperThreads.end()){\n"
+            boilerPlateStr += "\t\tstd::shared_ptr<helicsMexHelperThread> helper = existing->second;\n"
+            boilerPlateStr += "\t\twaitPumpingCallbacks([&](){ return helper->idle(); });\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* called once an object has been freed, a null object retires every helper */\n"
+            boilerPlateStr += "static void retireHelperThread(void *object) {\n"
+            boilerPlateStr += "\tif(object == nullptr){\n"
+            boilerPlateStr += "\t\thelperThreads.clear();\n"
+            boilerPlateStr += "\t}else{\n"
+            boilerPlateStr += "\t\thelperThreads.erase(object);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* number of handles set from MATLAB for callbacks that return a value to HELICS, their HELICS thread waits until\n"
+            boilerPlateStr += "   the MATLAB thread runs them, since any federate in the process can raise them a blocking call of every federate\n"
+            boilerPlateStr += "   keeps the MATLAB thread free while any of them is set */\n"
+            boilerPlateStr += "static int blockingMatlabCallbacks = 0;\n\n"
+            boilerPlateStr += "/* make a blocking HELICS call on an object, directly if no callback needs the MATLAB thread while it blocks and otherwise\n"
+            boilerPlateStr += "   on the helper thread of the object while the MATLAB thread runs the callbacks it raises */\n"
+            boilerPlateStr += "static void callPumpingCallbacks(void *object, const std::function<void()> &call) {\n"
+            boilerPlateStr += "\twaitForHelperThread(object);\n"
+            boilerPlateStr += "\tif(blockingMatlabCallbacks == 0){\n"
+            boilerPlateStr += "\t\tcall();\n"
+            boilerPlateStr += "\t\tpumpCallbackEvents();\n"
+            boilerPlateStr += "\t\treturn;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tstd::shared_ptr<helicsMexHelperThread> helper = getHelperThread(object);\n"
+            boilerPlateStr += "\thelper->start(call);\n"
+            boilerPlateStr += "\twaitPumpingCallbacks([&](){ return helper->idle(); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* a time request being completed on a helper thread for helicsFederatesWaitAny, defined with it */\n"
+            boilerPlateStr += "static bool takeTimeCompletion(HelicsFederate fed, HelicsTime *granted, HelicsError *err);\n\n"
+            boilerPlateStr += "/* the blocking federate and query calls below have the signature of the HELICS function they replace and keep\n"
+            boilerPlateStr += "   running queued callbacks while they wait, a callback that returns a value to HELICS would otherwise time out */\n"
+            boilerPlateStr += "static void helicsFederateEnterInitializingModeCompletePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateEnterInitializingModeComplete(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateEnterInitializingModePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateEnterInitializingMode(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateEnterInitializingModeIterativeCompletePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateEnterInitializingModeIterativeComplete(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateEnterInitializingModeIterativePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateEnterInitializingModeIterative(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateEnterExecutingModeCompletePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateEnterExecutingModeComplete(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateEnterExecutingModePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateEnterExecutingMode(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsIterationResult helicsFederateEnterExecutingModeIterativeCompletePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsIterationResult result = HELICS_ITERATION_RESULT_ERROR;\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsFederateEnterExecutingModeIterativeComplete(fed, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsIterationResult helicsFederateEnterExecutingModeIterativePumpingCallbacks(HelicsFederate fed, HelicsIterationRequest iterate, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsIterationResult result = HELICS_ITERATION_RESULT_ERROR;\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsFederateEnterExecutingModeIterative(fed, iterate, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsTime helicsFederateRequestTimeCompletePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsTime result = HELICS_TIME_INVALID;\n"
+            boilerPlateStr += "\tif(takeTimeCompletion(fed, &result, err)){\n"
+            boilerPlateStr += "\t\treturn result;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsFederateRequestTimeComplete(fed, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsTime helicsFederateRequestTimePumpingCallbacks(HelicsFederate fed, HelicsTime requestTime, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsTime result = HELICS_TIME_INVALID;\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsFederateRequestTime(fed, requestTime, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsTime helicsFederateRequestTimeIterativeCompletePumpingCallbacks(HelicsFederate fed, HelicsIterationResult *outIteration, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsTime result = HELICS_TIME_INVALID;\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsFederateRequestTimeIterativeComplete(fed, outIteration, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsTime helicsFederateRequestTimeIterativePumpingCallbacks(HelicsFederate fed, HelicsTime requestTime, HelicsIterationRequest iterate, HelicsIterationResult *outIteration, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsTime result = HELICS_TIME_INVALID;\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsFederateRequestTimeIterative(fed, requestTime, iterate, outIteration, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsTime helicsFederateRequestTimeAdvancePumpingCallbacks(HelicsFederate fed, HelicsTime timeDelta, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsTime result = HELICS_TIME_INVALID;\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsFederateRequestTimeAdvance(fed, timeDelta, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsTime helicsFederateRequestNextStepPumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsTime result = HELICS_TIME_INVALID;\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsFederateRequestNextStep(fed, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateProcessCommunicationsPumpingCallbacks(HelicsFederate fed, HelicsTime period, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateProcessCommunications(fed, period, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static const char *helicsFederateWaitCommandPumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tconst char *result = \"\";\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsFederateWaitCommand(fed, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateFinalizeCompletePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateFinalizeComplete(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateFinalizePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateFinalize(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateDisconnectCompletePumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateDisconnectComplete(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void helicsFederateDisconnectPumpingCallbacks(HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ helicsFederateDisconnect(fed, err); });\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* finalizing first leaves nothing for helicsFederateDestroy to wait for */\n"
+            boilerPlateStr += "static void helicsFederateDestroyPumpingCallbacks(HelicsFederate fed) {\n"
+            boilerPlateStr += "\tHelicsError err = helicsErrorInitialize();\n"
+            boilerPlateStr += "\thelicsFederateFinalizePumpingCallbacks(fed, &err);\n"
+            boilerPlateStr += "\thelicsFederateDestroy(fed);\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* a helper may still be using the federate until its time request is granted */\n"
+            boilerPlateStr += "static void helicsFederateFreePumpingCallbacks(HelicsFederate fed) {\n"
+            boilerPlateStr += "\twaitForHelperThread(fed);\n"
+            boilerPlateStr += "\thelicsFederateFree(fed);\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static const char *helicsQueryExecuteCompletePumpingCallbacks(HelicsQuery query, HelicsError *err) {\n"
+            boilerPlateStr += "\tconst char *result = \"\";\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(query, [&](){ result = helicsQueryExecuteComplete(query, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static const char *helicsQueryExecutePumpingCallbacks(HelicsQuery query, HelicsFederate fed, HelicsError *err) {\n"
+            boilerPlateStr += "\tconst char *result = \"\";\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(fed, [&](){ result = helicsQueryExecute(query, fed, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static const char *helicsQueryCoreExecutePumpingCallbacks(HelicsQuery query, HelicsCore core, HelicsError *err) {\n"
+            boilerPlateStr += "\tconst char *result = \"\";\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(core, [&](){ result = helicsQueryCoreExecute(query, core, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static const char *helicsQueryBrokerExecutePumpingCallbacks(HelicsQuery query, HelicsBroker broker, HelicsError *err) {\n"
+            boilerPlateStr += "\tconst char *result = \"\";\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(broker, [&](){ result = helicsQueryBrokerExecute(query, broker, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsBool helicsCoreWaitForDisconnectPumpingCallbacks(HelicsCore core, int msToWait, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsBool result = HELICS_FALSE;\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(core, [&](){ result = helicsCoreWaitForDisconnect(core, msToWait, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static HelicsBool helicsBrokerWaitForDisconnectPumpingCallbacks(HelicsBroker broker, int msToWait, HelicsError *err) {\n"
+            boilerPlateStr += "\tHelicsBool result = HELICS_FALSE;\n"
+            boilerPlateStr += "\tcallPumpingCallbacks(broker, [&](){ result = helicsBrokerWaitForDisconnect(broker, msToWait, err); });\n"
+            boilerPlateStr += "\treturn result;\n"
+            boilerPlateStr += "}\n"
+            boilerPlateStr += "/* a MATLAB function handle set as a HELICS callback, rhs[0] is the handle followed by argument arrays\n"
+            boilerPlateStr += "   that are created once and updated in place for every call, a null argument is created per call */\n"
+            boilerPlateStr += "struct helicsMexCallback {\n"
+            boilerPlateStr += "\tmxArray *rhs[4];\n"
+            boilerPlateStr += "\tint nrhs;\n"
+            boilerPlateStr += "\tint active;\n"
+            boilerPlateStr += "\thelicsMexCallback *next;\n"
+            boilerPlateStr += "\tint id;\n"
+            boilerPlateStr += "\tconst char *setter;\n"
+            boilerPlateStr += "\tvoid *object;\n"
+            boilerPlateStr += "\t/* the HELICS thread waits for the MATLAB thread to run the callback */\n"
+            boilerPlateStr += "\tbool blocking;\n"
+            boilerPlateStr += "\t/* clears the callback in HELICS, set by the setter since each object type has its own function */\n"
+            boilerPlateStr += "\tstd::function<void(HelicsError *)> detach;\n"
+            boilerPlateStr += "\tdouble calls;\n"
+            boilerPlateStr += "\tdouble totalSeconds;\n"
+            boilerPlateStr += "\tdouble maxSeconds;\n"
+            boilerPlateStr += "\t/* calls skipped because MATLAB did not run them within callbackReturnTimeout, counted on HELICS threads */\n"
+            boilerPlateStr += "\tstd::atomic<int> timeouts;\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "/* one slot per setter and object, setting a callback again reuses the slot so queued calls never see freed memory */\n"
+            boilerPlateStr += "static std::vector<helicsMexCallback *> matlabCallbacks;\n"
+            boilerPlateStr += "/* handles replaced while their callback was running, destroyed once no callback can be running */\n"
+            boilerPlateStr += "static std::vector<mxArray *> retiredCallbackHandles;\n"
+            boilerPlateStr += "static int lastCallbackId = 0;\n\n"
+            boilerPlateStr += "static helicsMexCallback *newMatlabCallback(std::initializer_list<mxArray *> arguments) {\n"
+            boilerPlateStr += "\thelicsMexCallback *callback = new helicsMexCallback();\n"
+            boilerPlateStr += "\tcallback->nrhs = 1;\n"
+            boilerPlateStr += "\tfor(mxArray *argument : arguments){\n"
+            boilerPlateStr += "\t\tif(argument != nullptr){\n"
+            boilerPlateStr += "\t\t\tmexMakeArrayPersistent(argument);\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tcallback->rhs[callback->nrhs++] = argument;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\treturn callback;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void setMatlabCallbackHandle(helicsMexCallback *callback, const mxArray *handle) {\n"
+            boilerPlateStr += "\tif(callback->rhs[0] != nullptr){\n"
+            boilerPlateStr += "\t\tif(callback->blocking){\n"
+            boilerPlateStr += "\t\t\t--blockingMatlabCallbacks;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tif(callback->active > 0){\n"
+            boilerPlateStr += "\t\t\tretiredCallbackHandles.push_back(callback->rhs[0]);\n"
+            boilerPlateStr += "\t\t}else{\n"
+            boilerPlateStr += "\t\t\tmxDestroyArray(callback->rhs[0]);\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tcallback->rhs[0] = nullptr;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tif(handle != nullptr){\n"
+            boilerPlateStr += "\t\tcallback->rhs[0] = mxDuplicateArray(handle);\n"
+            boilerPlateStr += "\t\tmexMakeArrayPersistent(callback->rhs[0]);\n"
+            boilerPlateStr += "\t\tif(callback->blocking){\n"
+            boilerPlateStr += "\t\t\t++blockingMatlabCallbacks;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tcallback->calls = 0.0;\n"
+            boilerPlateStr += "\tcallback->totalSeconds = 0.0;\n"
+            boilerPlateStr += "\tcallback->maxSeconds = 0.0;\n"
+            boilerPlateStr += "\tcallback->timeouts.store(0);\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* setters whose callbacks return a value to HELICS, or fill a buffer it reads, so HELICS waits for them */\n"
+            boilerPlateStr += "static bool isBlockingCallbackSetter(const char *setter) {\n"
+            boilerPlateStr += "\tstatic const char *const blockingSetters[] = {\"helicsFilterSetCustomCallback\", \"helicsTranslatorSetCustomCallback\", \"helicsFederateSetQueryCallback\",\n"
+            boilerPlateStr += "\t\t\"helicsCallbackFederateNextTimeCallback\", \"helicsCallbackFederateNextTimeIterativeCallback\", \"helicsCallbackFederateInitializeCallback\"};\n"
+            boilerPlateStr += "\tfor(const char *blockingSetter : blockingSetters){\n"
+            boilerPlateStr += "\t\tif(std::strcmp(setter, blockingSetter) == 0){\n"
+            boilerPlateStr += "\t\t\treturn true;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\treturn false;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* the callback slot for a setter call, nextHandle is the second function handle of setters that take two */\n"
+            boilerPlateStr += "static helicsMexCallback *registerMatlabCallback(const char *setter, void *object, const mxArray *handle, std::initializer_list<mxArray *> arguments, const mxArray *nextHandle = nullptr) {\n"
+            boilerPlateStr += "\tif(mexCallDepth == 1){\n"
+            boilerPlateStr += "\t\tfor(mxArray *retired : retiredCallbackHandles){\n"
+            boilerPlateStr += "\t\t\tmxDestroyArray(retired);\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tretiredCallbackHandles.clear();\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tif(mxGetClassID(handle) != mxFUNCTION_CLASS || (nextHandle != nullptr && mxGetClassID(nextHandle) != mxFUNCTION_CLASS)){\n"
+            boilerPlateStr += "\t\tfor(mxArray *argument : arguments){\n"
+            boilerPlateStr += "\t\t\tif(argument != nullptr){\n"
+            boilerPlateStr += "\t\t\t\tmxDestroyArray(argument);\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tmexUnlock();\n"
+            boilerPlateStr += "\t\thelicsMexErrMsgIdAndTxt((std::string(\"MATLAB:\") + setter + \":TypeError\").c_str(),\"The callback must be a function handle.\");\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\thelicsMexCallback *callback = nullptr;\n"
+            boilerPlateStr += "\tfor(helicsMexCallback *slot : matlabCallbacks){\n"
+            boilerPlateStr += "\t\tif(slot->object == object && std::strcmp(slot->setter, setter) == 0){\n"
+            boilerPlateStr += "\t\t\tcallback = slot;\n"
+            boilerPlateStr += "\t\t\tbreak;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tif(callback == nullptr){\n"
+            boilerPlateStr += "\t\tcallback = newMatlabCallback(arguments);\n"
+            boilerPlateStr += "\t\tcallback->setter = setter;\n"
+            boilerPlateStr += "\t\tcallback->object = object;\n"
+            boilerPlateStr += "\t\tcallback->blocking = isBlockingCallbackSetter(setter);\n"
+            boilerPlateStr += "\t\tif(nextHandle != nullptr){\n"
+            boilerPlateStr += "\t\t\tcallback->next = newMatlabCallback({});\n"
+            boilerPlateStr += "\t\t\tcallback->next->setter = setter;\n"
+            boilerPlateStr += "\t\t\tcallback->next->object = object;\n"
+            boilerPlateStr += "\t\t\tcallback->next->blocking = callback->blocking;\n"
+            boilerPlateStr += "\t\t\tfor(int ii = 1; ii < callback->nrhs; ++ii){\n"
+            boilerPlateStr += "\t\t\t\tcallback->next->rhs[ii] = (callback->rhs[ii] != nullptr) ? mxDuplicateArray(callback->rhs[ii]) : nullptr;\n"
+            boilerPlateStr += "\t\t\t\tif(callback->next->rhs[ii] != nullptr){\n"
+            boilerPlateStr += "\t\t\t\t\tmexMakeArrayPersistent(callback->next->rhs[ii]);\n"
+            boilerPlateStr += "\t\t\t\t}\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t\tcallback->next->nrhs = callback->nrhs;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tmatlabCallbacks.push_back(callback);\n"
+            boilerPlateStr += "\t}else{\n"
+            boilerPlateStr += "\t\tfor(mxArray *argument : arguments){\n"
+            boilerPlateStr += "\t\t\tif(argument != nullptr){\n"
+            boilerPlateStr += "\t\t\t\tmxDestroyArray(argument);\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tcallback->id = ++lastCallbackId;\n"
+            boilerPlateStr += "\tsetMatlabCallbackHandle(callback, handle);\n"
+            boilerPlateStr += "\tif(callback->next != nullptr){\n"
+            boilerPlateStr += "\t\tcallback->next->id = callback->id;\n"
+            boilerPlateStr += "\t\tsetMatlabCallbackHandle(callback->next, nextHandle);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\treturn callback;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static helicsMexCallback *findMatlabCallback(int id) {\n"
+            boilerPlateStr += "\tfor(helicsMexCallback *slot : matlabCallbacks){\n"
+            boilerPlateStr += "\t\tif(slot->id == id && slot->rhs[0] != nullptr){\n"
+            boilerPlateStr += "\t\t\treturn slot;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\treturn nullptr;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* clear a callback in HELICS and release its handle, calls that are already queued do nothing */\n"
+            boilerPlateStr += "static void removeMatlabCallback(helicsMexCallback *callback, HelicsError *err) {\n"
+            boilerPlateStr += "\tif(callback->detach){\n"
+            boilerPlateStr += "\t\tcallback->detach(err);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tfor(helicsMexCallback *part = callback; part != nullptr; part = part->next){\n"
+            boilerPlateStr += "\t\tsetMatlabCallbackHandle(part, nullptr);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* release every handle and argument array when the mex file is unloaded, the slots stay allocated for any HELICS thread still holding them */\n"
+            boilerPlateStr += "static void clearMatlabCallbacks() {\n"
+            boilerPlateStr += "\tfor(helicsMexCallback *slot : matlabCallbacks){\n"
+            boilerPlateStr += "\t\tfor(helicsMexCallback *part = slot; part != nullptr; part = part->next){\n"
+            boilerPlateStr += "\t\t\tfor(int ii = 0; ii < part->nrhs; ++ii){\n"
+            boilerPlateStr += "\t\t\t\tif(part->rhs[ii] != nullptr){\n"
+            boilerPlateStr += "\t\t\t\t\tmxDestroyArray(part->rhs[ii]);\n"
+            boilerPlateStr += "\t\t\t\t\tpart->rhs[ii] = nullptr;\n"
+            boilerPlateStr += "\t\t\t\t}\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tfor(mxArray *retired : retiredCallbackHandles){\n"
+            boilerPlateStr += "\t\tmxDestroyArray(retired);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tretiredCallbackHandles.clear();\n"
+            boilerPlateStr += "\tblockingMatlabCallbacks = 0;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* the argument arrays for one call of a callback, a callback that is already running further up the stack gets copies */\n"
+            boilerPlateStr += "struct helicsMexCallbackCall {\n"
+            boilerPlateStr += "\thelicsMexCallback *callback;\n"
+            boilerPlateStr += "\tmxArray *rhs[4];\n\n"
+            boilerPlateStr += "\texplicit helicsMexCallbackCall(void *userData) : callback(static_cast<helicsMexCallback *>(userData)) {\n"
+            boilerPlateStr += "\t\tbool nested = (callback->active++ > 0);\n"
+            boilerPlateStr += "\t\trhs[0] = callback->rhs[0];\n"
+            boilerPlateStr += "\t\tfor(int ii = 1; ii < callback->nrhs; ++ii){\n"
+            boilerPlateStr += "\t\t\trhs[ii] = (nested && callback->rhs[ii] != nullptr) ? mxDuplicateArray(callback->rhs[ii]) : callback->rhs[ii];\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\t~helicsMexCallbackCall() {\n"
+            boilerPlateStr += "\t\tfor(int ii = 1; ii < callback->nrhs; ++ii){\n"
+            boilerPlateStr += "\t\t\tif(rhs[ii] != callback->rhs[ii]){\n"
+            boilerPlateStr += "\t\t\t\tmxDestroyArray(rhs[ii]);\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\t--callback->active;\n"
+            boilerPlateStr += "\t}\n\n"
+            boilerPlateStr += "\t/* returns non zero without calling MATLAB if the callback has been removed or the mex file is being unloaded,\n"
+            boilerPlateStr += "\t   or if it raised an error which is deferred */\n"
+            boilerPlateStr += "\tint call(int nlhs, mxArray *lhs[]) {\n"
+            boilerPlateStr += "\t\tif(rhs[0] == nullptr || callbackQueueClosed){\n"
+            boilerPlateStr += "\t\t\treturn -1;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tstd::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();\n"
+            boilerPlateStr += "\t\tint status = callMatlabFunction(nlhs, lhs, callback->nrhs, rhs);\n"
+            boilerPlateStr += "\t\tdouble seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();\n"
+            boilerPlateStr += "\t\tcallback->calls += 1.0;\n"
+            boilerPlateStr += "\t\tcallback->totalSeconds += seconds;\n"
+            boilerPlateStr += "\t\tcallback->maxSeconds = std::max(callback->maxSeconds, seconds);\n"
+            boilerPlateStr += "\t\treturn status;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "/* query answers given without calling MATLAB, a static string or a live value that is formatted when it is queried */\n"
+            boilerPlateStr += "struct helicsMexQueryResponse {\n"
+            boilerPlateStr += "\tbool live;\n"
+            boilerPlateStr += "\tstd::string answer;\n"
+            boilerPlateStr += "\tstd::vector<double> values;\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "static std::mutex queryResponseLock;\n"
+            boilerPlateStr += "static std::unordered_map<void *, std::unordered_map<std::string, helicsMexQueryResponse>> queryResponses;\n\n"
+            boilerPlateStr += "static void formatLiveQueryResponse(std::string &answer, const std::vector<double> &values) {\n"
+            boilerPlateStr += "\tchar number[32];\n"
+            boilerPlateStr += "\tif(values.size() != 1){\n"
+            boilerPlateStr += "\t\tanswer.push_back('[');\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tfor(size_t ii = 0; ii < values.size(); ++ii){\n"
+            boilerPlateStr += "\t\tif(ii > 0){\n"
+            boilerPlateStr += "\t\t\tanswer.push_back(',');\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tsnprintf(number, sizeof(number), \"%.17g\", values[ii]);\n"
+            boilerPlateStr += "\t\tanswer.append(number);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tif(values.size() != 1){\n"
+            boilerPlateStr += "\t\tanswer.push_back(']');\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* fill the query buffer if the federate has a native answer for the query, may be called on any thread */\n"
+            boilerPlateStr += "static bool answerNativeQuery(void *fed, const char *query, int querySize, HelicsQueryBuffer buffer) {\n"
+            boilerPlateStr += "\tstd::string answer;\n"
+            boilerPlateStr += "\t{\n"
+            boilerPlateStr += "\t\tstd::lock_guard<std::mutex> guard(queryResponseLock);\n"
+            boilerPlateStr += "\t\tauto responses = queryResponses.find(fed);\n"
+            boilerPlateStr += "\t\tif(responses == queryResponses.end()){\n"
+            boilerPlateStr += "\t\t\treturn false;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tauto response = responses->second.find(std::string(query, querySize));\n"
+            boilerPlateStr += "\t\tif(response == responses->second.end()){\n"
+            boilerPlateStr += "\t\t\treturn false;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tif(response->second.live){\n"
+            boilerPlateStr += "\t\t\tformatLiveQueryResponse(answer, response->second.values);\n"
+            boilerPlateStr += "\t\t}else{\n"
+            boilerPlateStr += "\t\t\tanswer = response->second.answer;\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tHelicsError err = helicsErrorInitialize();\n"
+            boilerPlateStr += "\thelicsQueryBufferFill(buffer, answer.c_str(), static_cast<int>(answer.size()), &err);\n"
+            boilerPlateStr += "\treturn true;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* the query callback of a federate with native answers and no MATLAB query callback */\n"
+            boilerPlateStr += "static void nativeQueryResponseCallback(const char *query, int querySize, HelicsQueryBuffer buffer, void *userData) {\n"
+            boilerPlateStr += "\tanswerNativeQuery(userData, query, querySize, buffer);\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* kinds of HELICS objects handed to MATLAB that have to be freed, in the order they are torn down */\n"
+            boilerPlateStr += "enum helicsMexObjectType {\n"
+            boilerPlateStr += "\tHELICS_MEX_MESSAGE,\n"
+            boilerPlateStr += "\tHELICS_MEX_QUERY,\n"
+            boilerPlateStr += "\tHELICS_MEX_DATA_BUFFER,\n"
+            boilerPlateStr += "\tHELICS_MEX_FEDERATE_INFO,\n"
+            boilerPlateStr += "\tHELICS_MEX_FEDERATE,\n"
+            boilerPlateStr += "\tHELICS_MEX_CORE,\n"
+            boilerPlateStr += "\tHELICS_MEX_BROKER,\n"
+            boilerPlateStr += "\tHELICS_MEX_OBJECT_TYPE_COUNT\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "static const char *helicsMexObjectTypeNames[HELICS_MEX_OBJECT_TYPE_COUNT] = {\"messages\", \"queries\", \"dataBuffers\", \"federateInfos\", \"federates\", \"cores\", \"brokers\"};\n\n"
+            boilerPlateStr += "/* a live object and, for messages, the federate that owns it or nullptr if it is not known */\n"
+            boilerPlateStr += "struct helicsMexObject {\n"
+            boilerPlateStr += "\thelicsMexObjectType type;\n"
+            boilerPlateStr += "\tvoid *owner;\n"
+            boilerPlateStr += "};\n\n"
+            boilerPlateStr += "static std::unordered_map<void *, helicsMexObject> liveHelicsObjects;\n"
+            boilerPlateStr += "/* federate or core of every interface handed to MATLAB, messages from an endpoint belong to its federate\n"
+            boilerPlateStr += "   and the callbacks and cached state of an interface go away with its owner */\n"
+            boilerPlateStr += "static std::unordered_map<void *, void *> interfaceOwners;\n"
+            boilerPlateStr += "/* filters registered as cloning filters, only they deliver copies to delivery endpoints */\n"
+            boilerPlateStr += "static std::unordered_set<void *> cloningFilters;\n\n"
+            boilerPlateStr += "static void trackHelicsObject(helicsMexObjectType type, void *object, void *owner = nullptr) {\n"
+            boilerPlateStr += "\tif(object != nullptr){\n"
+            boilerPlateStr += "\t\tliveHelicsObjects[object] = helicsMexObject{type, owner};\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void trackHelicsInterface(void *handle, void *owner, bool cloning = false) {\n"
+            boilerPlateStr += "\tif(handle != nullptr){\n"
+            boilerPlateStr += "\t\tinterfaceOwners[handle] = owner;\n"
+            boilerPlateStr += "\t\tif(cloning){\n"
+            boilerPlateStr += "\t\t\tcloningFilters.insert(handle);\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void *getInterfaceOwner(void *handle) {\n"
+            boilerPlateStr += "\tauto owner = interfaceOwners.find(handle);\n"
+            boilerPlateStr += "\treturn (owner != interfaceOwners.end()) ? owner->second : nullptr;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static void *getHelicsObjectOwner(void *object) {\n"
+            boilerPlateStr += "\tauto live = liveHelicsObjects.find(object);\n"
+            boilerPlateStr += "\treturn (live != liveHelicsObjects.end()) ? live->second.owner : nullptr;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "static bool isHelicsObjectLive(void *object, helicsMexObjectType type) {\n"
+            boilerPlateStr += "\tauto live = liveHelicsObjects.find(object);\n"
+            boilerPlateStr += "\treturn live != liveHelicsObjects.end() && live->second.type == type;\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* per object state of the extra functions, defined with them, a null object drops the state of every object */\n"
+            boilerPlateStr += "static void dropMessagePool(HelicsFederate fed);\n"
+            boilerPlateStr += "static void forgetPooledMessage(HelicsMessage message);\n"
+            boilerPlateStr += "static void forgetInputDataTypes(HelicsFederate fed);\n"
+            boilerPlateStr += "static void retireLoggingBuffer(void *object);\n"
+            boilerPlateStr += "static void forgetTimeCompletion(HelicsFederate fed);\n"
+            boilerPlateStr += "static void retireFilterOperators(HelicsFilter filt);\n\n"
+            boilerPlateStr += "/* forget the messages HELICS freed with a federate, messages with no known owner may have been among them */\n"
+            boilerPlateStr += "static void releaseFederateMessages(HelicsFederate fed) {\n"
+            boilerPlateStr += "\tdropMessagePool(fed);\n"
+            boilerPlateStr += "\tfor(auto live = liveHelicsObjects.begin(); live != liveHelicsObjects.end();){\n"
+            boilerPlateStr += "\t\tbool owned = live->second.type == HELICS_MEX_MESSAGE && (live->second.owner == fed || live->second.owner == nullptr);\n"
+            boilerPlateStr += "\t\tlive = owned ? liveHelicsObjects.erase(live) : std::next(live);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* forget an object after it is freed, along with whatever HELICS freed with it */\n"
+            boilerPlateStr += "static void releaseHelicsObject(void *object) {\n"
+            boilerPlateStr += "\tauto live = liveHelicsObjects.find(object);\n"
+            boilerPlateStr += "\tif(live == liveHelicsObjects.end()){\n"
+            boilerPlateStr += "\t\treturn;\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\thelicsMexObjectType type = live->second.type;\n"
+            boilerPlateStr += "\tliveHelicsObjects.erase(live);\n"
+            boilerPlateStr += "\tretireHelperThread(object);\n"
+            boilerPlateStr += "\tif(type == HELICS_MEX_MESSAGE){\n"
+            boilerPlateStr += "\t\tforgetPooledMessage(object);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tif(type == HELICS_MEX_FEDERATE){\n"
+            boilerPlateStr += "\t\treleaseFederateMessages(object);\n"
+            boilerPlateStr += "\t\tforgetInputDataTypes(object);\n"
+            boilerPlateStr += "\t\tforgetTimeCompletion(object);\n"
+            boilerPlateStr += "\t\tstd::lock_guard<std::mutex> guard(queryResponseLock);\n"
+            boilerPlateStr += "\t\tqueryResponses.erase(object);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tif(type == HELICS_MEX_FEDERATE || type == HELICS_MEX_CORE){\n"
+            boilerPlateStr += "\t\tfor(auto owner = interfaceOwners.begin(); owner != interfaceOwners.end();){\n"
+            boilerPlateStr += "\t\t\tif(owner->second == object){\n"
+            boilerPlateStr += "\t\t\t\tcloningFilters.erase(owner->first);\n"
+            boilerPlateStr += "\t\t\t\tretireFilterOperators(owner->first);\n"
+            boilerPlateStr += "\t\t\t\towner = interfaceOwners.erase(owner);\n"
+            boilerPlateStr += "\t\t\t}else{\n"
+            boilerPlateStr += "\t\t\t\t++owner;\n"
+            boilerPlateStr += "\t\t\t}\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tif(type == HELICS_MEX_FEDERATE || type == HELICS_MEX_CORE || type == HELICS_MEX_BROKER){\n"
+            boilerPlateStr += "\t\tretireLoggingBuffer(object);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* helicsCloseLibrary frees every broker, core and federate and the messages of the federates */\n"
+            boilerPlateStr += "static void releaseLibraryObjects() {\n"
+            boilerPlateStr += "\tfor(auto live = liveHelicsObjects.begin(); live != liveHelicsObjects.end();){\n"
+            boilerPlateStr += "\t\thelicsMexObjectType type = live->second.type;\n"
+            boilerPlateStr += "\t\tbool freed = type == HELICS_MEX_MESSAGE || type == HELICS_MEX_FEDERATE || type == HELICS_MEX_CORE || type == HELICS_MEX_BROKER;\n"
+            boilerPlateStr += "\t\tif(freed){\n"
+            boilerPlateStr += "\t\t\tretireHelperThread(live->first);\n"
+            boilerPlateStr += "\t\t}\n"
+            boilerPlateStr += "\t\tlive = freed ? liveHelicsObjects.erase(live) : std::next(live);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tinterfaceOwners.clear();\n"
+            boilerPlateStr += "\tcloningFilters.clear();\n"
+            boilerPlateStr += "\tdropMessagePool(nullptr);\n"
+            boilerPlateStr += "\tforgetInputDataTypes(nullptr);\n"
+            boilerPlateStr += "\tretireLoggingBuffer(nullptr);\n"
+            boilerPlateStr += "\tforgetTimeCompletion(nullptr);\n"
+            boilerPlateStr += "\tretireFilterOperators(nullptr);\n"
+            boilerPlateStr += "\tstd::lock_guard<std::mutex> guard(queryResponseLock);\n"
+            boilerPlateStr += "\tqueryResponses.clear();\n"
+            boilerPlateStr += "}\n\n"
+            boilerPlateStr += "/* free every live object, messages before the federates that own them and federates before their cores and brokers */\n"
+            boilerPlateStr += "static void freeHelicsObjects() {\n"
+            boilerPlateStr += "\tstd::vector<void *> objects[HELICS_MEX_OBJECT_TYPE_COUNT];\n"
+            boilerPlateStr += "\tfor(auto &live : liveHelicsObjects){\n"
+            boilerPlateStr += "\t\tobjects[live.second.type].push_back(live.first);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tliveHelicsObjects.clear();\n"
+            boilerPlateStr += "\tretireHelperThread(nullptr);\n"
+            boilerPlateStr += "\tinterfaceOwners.clear();\n"
+            boilerPlateStr += "\tcloningFilters.clear();\n"
+            boilerPlateStr += "\tfor(void *message : objects[HELICS_MEX_MESSAGE]){\n"
+            boilerPlateStr += "\t\thelicsMessageFree(message);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tfor(void *query : objects[HELICS_MEX_QUERY]){\n"
+            boilerPlateStr += "\t\thelicsQueryFree(query);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tfor(void *buffer : objects[HELICS_MEX_DATA_BUFFER]){\n"
+            boilerPlateStr += "\t\thelicsDataBufferFree(buffer);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tfor(void *fedInfo : objects[HELICS_MEX_FEDERATE_INFO]){\n"
+            boilerPlateStr += "\t\thelicsFederateInfoFree(fedInfo);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tfor(void *fed : objects[HELICS_MEX_FEDERATE]){\n"
+            boilerPlateStr += "\t\thelicsFederateDestroy(fed);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tfor(void *core : objects[HELICS_MEX_CORE]){\n"
+            boilerPlateStr += "\t\thelicsCoreDestroy(core);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "\tfor(void *broker : objects[HELICS_MEX_BROKER]){\n"
+            boilerPlateStr += "\t\thelicsBrokerDestroy(broker);\n"
+            boilerPlateStr += "\t}\n"
+            boilerPlateStr += "}\n\n"
             boilerPlateStr += "static const std::unordered_map<std::string,int> wrapperFunctionMap{\n"
             for i in range(len(helicsElementMapTuples)):
                 if i == 0:
@@ -157,12 +1119,12 @@ class MatlabBindingGenerator(object):
                     macroFile.write(f"function v = {macroSpelling}()\n")
                     if macroComment != None:
                         macroFile.write(f"% {macroComment}\n")
-                    macroFile.write(f"\tv = helicsMex('{macroSpelling}');\n")
+                    macroFile.write(f"\tv = helicsMex(int32({cursorIdx}));\n")
                     macroFile.write("end\n")
                 macroWrapperStr += f"void _wrap_{macroSpelling}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
                 macroWrapperStr += "\tif(argc != 0){\n"
                 macroWrapperStr += "\t\tmexUnlock();\n"
-                macroWrapperStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{macroSpelling}:rhs\",\"This function doesn't take arguments.\");\n"
+                macroWrapperStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{macroSpelling}:rhs\",\"This function doesn't take arguments.\");\n"
                 macroWrapperStr += "\t}\n"
                 macroWrapperStr += "\tmxArray *_out = mxCreateNumericMatrix(1,1,mxINT64_CLASS,mxREAL);\n"
                 macroWrapperStr += f"\t*((int64_t*)mxGetData(_out)) = (int64_t){macroSpelling};\n"
@@ -282,6 +1244,82 @@ class MatlabBindingGenerator(object):
                 "helicsCallbackFederateInitializeCallback"
             ]
             functionsToIgnore = ["helicsErrorInitialize", "helicsErrorClear", "helicsDataBufferFillFromComplexObject"]
+            # blocking calls that run callbacks queued by HELICS threads while they wait
+            callbackPumpingFunctions = {
+                "helicsFederateEnterInitializingModeComplete": "helicsFederateEnterInitializingModeCompletePumpingCallbacks",
+                "helicsFederateEnterInitializingMode": "helicsFederateEnterInitializingModePumpingCallbacks",
+                "helicsFederateEnterInitializingModeIterativeComplete": "helicsFederateEnterInitializingModeIterativeCompletePumpingCallbacks",
+                "helicsFederateEnterInitializingModeIterative": "helicsFederateEnterInitializingModeIterativePumpingCallbacks",
+                "helicsFederateEnterExecutingModeComplete": "helicsFederateEnterExecutingModeCompletePumpingCallbacks",
+                "helicsFederateEnterExecutingMode": "helicsFederateEnterExecutingModePumpingCallbacks",
+                "helicsFederateEnterExecutingModeIterativeComplete": "helicsFederateEnterExecutingModeIterativeCompletePumpingCallbacks",
+                "helicsFederateEnterExecutingModeIterative": "helicsFederateEnterExecutingModeIterativePumpingCallbacks",
+                "helicsFederateRequestTimeComplete": "helicsFederateRequestTimeCompletePumpingCallbacks",
+                "helicsFederateRequestTime": "helicsFederateRequestTimePumpingCallbacks",
+                "helicsFederateRequestTimeAdvance": "helicsFederateRequestTimeAdvancePumpingCallbacks",
+                "helicsFederateRequestNextStep": "helicsFederateRequestNextStepPumpingCallbacks",
+                "helicsFederateProcessCommunications": "helicsFederateProcessCommunicationsPumpingCallbacks",
+                "helicsFederateWaitCommand": "helicsFederateWaitCommandPumpingCallbacks",
+                "helicsFederateFinalizeComplete": "helicsFederateFinalizeCompletePumpingCallbacks",
+                "helicsFederateFinalize": "helicsFederateFinalizePumpingCallbacks",
+                "helicsFederateDisconnectComplete": "helicsFederateDisconnectCompletePumpingCallbacks",
+                "helicsFederateDisconnect": "helicsFederateDisconnectPumpingCallbacks",
+                "helicsFederateDestroy": "helicsFederateDestroyPumpingCallbacks",
+                "helicsFederateFree": "helicsFederateFreePumpingCallbacks",
+                "helicsQueryExecuteComplete": "helicsQueryExecuteCompletePumpingCallbacks",
+                "helicsQueryExecute": "helicsQueryExecutePumpingCallbacks",
+                "helicsQueryCoreExecute": "helicsQueryCoreExecutePumpingCallbacks",
+                "helicsQueryBrokerExecute": "helicsQueryBrokerExecutePumpingCallbacks",
+                "helicsCoreWaitForDisconnect": "helicsCoreWaitForDisconnectPumpingCallbacks",
+                "helicsBrokerWaitForDisconnect": "helicsBrokerWaitForDisconnectPumpingCallbacks"
+            }
+            # objects returned to MATLAB that are tracked until they are freed, with the federate that owns a message
+            trackedObjectCreators = {
+                "helicsCreateDataBuffer": ("HELICS_MEX_DATA_BUFFER", None),
+                "helicsWrapDataInBuffer": ("HELICS_MEX_DATA_BUFFER", None),
+                "helicsDataBufferClone": ("HELICS_MEX_DATA_BUFFER", None),
+                "helicsInputGetDataBuffer": ("HELICS_MEX_DATA_BUFFER", None),
+                "helicsCreateCore": ("HELICS_MEX_CORE", None),
+                "helicsCoreClone": ("HELICS_MEX_CORE", None),
+                "helicsFederateGetCore": ("HELICS_MEX_CORE", None),
+                "helicsCreateBroker": ("HELICS_MEX_BROKER", None),
+                "helicsBrokerClone": ("HELICS_MEX_BROKER", None),
+                "helicsGetFederateByName": ("HELICS_MEX_FEDERATE", None),
+                "helicsCreateValueFederate": ("HELICS_MEX_FEDERATE", None),
+                "helicsCreateValueFederateFromConfig": ("HELICS_MEX_FEDERATE", None),
+                "helicsCreateMessageFederate": ("HELICS_MEX_FEDERATE", None),
+                "helicsCreateMessageFederateFromConfig": ("HELICS_MEX_FEDERATE", None),
+                "helicsCreateCombinationFederate": ("HELICS_MEX_FEDERATE", None),
+                "helicsCreateCombinationFederateFromConfig": ("HELICS_MEX_FEDERATE", None),
+                "helicsCreateCallbackFederate": ("HELICS_MEX_FEDERATE", None),
+                "helicsCreateCallbackFederateFromConfig": ("HELICS_MEX_FEDERATE", None),
+                "helicsFederateClone": ("HELICS_MEX_FEDERATE", None),
+                "helicsCreateFederateInfo": ("HELICS_MEX_FEDERATE_INFO", None),
+                "helicsFederateInfoClone": ("HELICS_MEX_FEDERATE_INFO", None),
+                "helicsCreateQuery": ("HELICS_MEX_QUERY", None),
+                "helicsEndpointGetMessage": ("HELICS_MEX_MESSAGE", "getInterfaceOwner(endpoint)"),
+                "helicsEndpointCreateMessage": ("HELICS_MEX_MESSAGE", "getInterfaceOwner(endpoint)"),
+                "helicsFederateGetMessage": ("HELICS_MEX_MESSAGE", "fed"),
+                "helicsFederateCreateMessage": ("HELICS_MEX_MESSAGE", "fed"),
+                "helicsMessageClone": ("HELICS_MEX_MESSAGE", "getHelicsObjectOwner(message)")
+            }
+            # interfaces returned to MATLAB that are tracked with the federate or core that owns them
+            trackedInterfaceTypes = ["HelicsEndpoint", "HelicsFilter", "HelicsTranslator", "HelicsInput", "HelicsPublication"]
+            # objects that HELICS has freed once the call returns
+            trackedObjectReleasers = {
+                "helicsDataBufferFree": "releaseHelicsObject(data)",
+                "helicsFederateDestroy": "releaseHelicsObject(fed)",
+                "helicsFederateFree": "releaseHelicsObject(fed)",
+                "helicsCoreDestroy": "releaseHelicsObject(core)",
+                "helicsCoreFree": "releaseHelicsObject(core)",
+                "helicsBrokerDestroy": "releaseHelicsObject(broker)",
+                "helicsBrokerFree": "releaseHelicsObject(broker)",
+                "helicsFederateInfoFree": "releaseHelicsObject(fedInfo)",
+                "helicsQueryFree": "releaseHelicsObject(query)",
+                "helicsMessageFree": "releaseHelicsObject(message)",
+                "helicsEndpointSendMessageZeroCopy": "releaseHelicsObject(message)",
+                "helicsFederateClearMessages": "releaseFederateMessages(fed)"
+            }
             functionName = functionDict.get("spelling")
             if functionName in modifiedMatlabFunctionList:
                 return createModifiedMatlabFunction(functionDict, cursorIdx)
@@ -301,7 +1339,7 @@ class MatlabBindingGenerator(object):
                 with open(os.path.join(self.__rootDir, f"matlabBindings/+helics/{functionName}.m"), "w") as functionMFile:
                     functionMFile.write(f"function varargout = {functionName}(varargin)\n")
                     functionMFile.write(functionComment)
-                    functionMFile.write("\t[varargout{1:nargout}] = helicsMex(" + f"'{functionName}', varargin" + "{:});\n")
+                    functionMFile.write("\t[varargout{1:nargout}] = helicsMex(" + f"int32({cursorIdx}), varargin" + "{:});\n")
                     functionMFile.write("end\n")
                 functionWrapperStr = ""
                 functionMainElements = ""
@@ -317,10 +1355,21 @@ class MatlabBindingGenerator(object):
                     else:
                         functionWrapperStr += getArgInitializationStr(functionDict.get("arguments",{}).get(a,{}), int(a), functionName)
                 if functionDict.get("result_type","") != "Void":
-                    functionWrapperStr += f"{getFunctionReturnInitializationStr(functionDict)} = {functionName}("
+                    functionWrapperStr += f"{getFunctionReturnInitializationStr(functionDict)} = {callbackPumpingFunctions.get(functionName, functionName)}("
                     for a in functionDict.get("arguments",{}).keys():
                         functionWrapperStr += getArgFunctionCallStr(functionDict.get("arguments",{}).get(a,{}), int(a))
                     functionWrapperStr += ");\n\n"
+                    if functionName in trackedObjectCreators.keys():
+                        objectType, objectOwner = trackedObjectCreators[functionName]
+                        if objectOwner is None:
+                            functionWrapperStr += f"\ttrackHelicsObject({objectType}, result);\n\n"
+                        else:
+                            functionWrapperStr += f"\ttrackHelicsObject({objectType}, result, {objectOwner});\n\n"
+                    elif functionDict.get("result_type","") in trackedInterfaceTypes and functionDict.get("arguments",{}).get(0,{}).get("type","") in ["HelicsFederate", "HelicsCore"]:
+                        if functionName.endswith("CloningFilter"):
+                            functionWrapperStr += f"\ttrackHelicsInterface(result, {functionDict.get('arguments',{}).get(0,{}).get('spelling','')}, true);\n\n"
+                        else:
+                            functionWrapperStr += f"\ttrackHelicsInterface(result, {functionDict.get('arguments',{}).get(0,{}).get('spelling','')});\n\n"
                     functionWrapperStr += getFunctionReturnConversionStr(functionDict)
                     functionWrapperStr += "\n\n\tif(_out){\n"
                     functionWrapperStr += "\t\t--resc;\n"
@@ -333,10 +1382,17 @@ class MatlabBindingGenerator(object):
                             functionWrapperStr += argCleanupStr
                     functionWrapperStr += "\n}\n\n\n"
                 else:
-                    functionWrapperStr += f"\t{functionName}("
+                    functionWrapperStr += f"\t{callbackPumpingFunctions.get(functionName, functionName)}("
                     for a in functionDict.get("arguments",{}).keys():
                         functionWrapperStr += getArgFunctionCallStr(functionDict.get("arguments",{}).get(a,{}), int(a))
                     functionWrapperStr += ");\n\n"
+                    if functionName in trackedObjectReleasers.keys():
+                        if any(arg.get("pointer_type","") == "HelicsError_*" for arg in functionDict.get("arguments",{}).values()):
+                            functionWrapperStr += "\tif(err.error_code == HELICS_OK){\n"
+                            functionWrapperStr += f"\t\t{trackedObjectReleasers[functionName]};\n"
+                            functionWrapperStr += "\t}\n\n"
+                        else:
+                            functionWrapperStr += f"\t{trackedObjectReleasers[functionName]};\n\n"
                     functionWrapperStr += "\tmxArray *_out = nullptr;\n\n"
                     functionWrapperStr += "\tif(_out){\n"
                     functionWrapperStr += "\t\t--resc;\n"
@@ -377,12 +1433,12 @@ class MatlabBindingGenerator(object):
             if lastArgOptional:
                 argCheckStr += f"\tif(argc < {argCount - 1} || argc > {argCount}){{\n"
                 argCheckStr += "\t\tmexUnlock();\n"
-                argCheckStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires at least {argCount - 1} arguments and at most {argCount} arguments.\");\n"
+                argCheckStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires at least {argCount - 1} arguments and at most {argCount} arguments.\");\n"
                 argCheckStr += "\t}\n\n"
             else:
                 argCheckStr += f"\tif(argc != {argCount}){{\n"
                 argCheckStr += "\t\tmexUnlock();\n"
-                argCheckStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires {argCount} arguments.\");\n"
+                argCheckStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires {argCount} arguments.\");\n"
                 argCheckStr += "\t}\n\n"
             return argCheckStr
         
@@ -549,8 +1605,8 @@ class MatlabBindingGenerator(object):
         
         def getArgFunctionCleanUpStr(argDict: Dict[str,str]) -> str:
             argCleanUpMap = {
-                "Char_S": argCharPostFunctionCall(argDict.get("spelling","")),
-                "Char_S_*": argCharPostFunctionCall(argDict.get("spelling","")),
+                "Char_S": "",
+                "Char_S_*": "",
                 "Double": "",
                 "Int": "",
                 "Void_*": "",
@@ -594,13 +1650,13 @@ class MatlabBindingGenerator(object):
             if not argIsOptional:
                 retStr += f"\tif(!mxIsChar(argv[{position}])){{\n"
                 retStr += "\t\tmexUnlock();\n"
-                retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be a string.\");\n"
+                retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be a string.\");\n"
                 retStr += "\t}\n"
             else:
                 retStr += f"\tif(argc > {position}){{\n"
                 retStr += f"\t\tif(!mxIsChar(argv[{position}])){{\n"
                 retStr += "\t\t\tmexUnlock();\n"
-                retStr += f"\t\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be a string.\");\n"
+                retStr += f"\t\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be a string.\");\n"
                 retStr += "\t\t}\n"
                 retStr += "\t}\n"
             retStr += f"\tchar *{argName} = nullptr;\n"
@@ -608,7 +1664,7 @@ class MatlabBindingGenerator(object):
             retStr += f"\tint {argName}Status = 0;\n"
             retStr += f"\tif(argc > {position}){{\n"
             retStr += f"\t\t{argName}Length = mxGetN(argv[{position}]) + 1;\n"
-            retStr += f"\t\t{argName} = static_cast<char *>(malloc({argName}Length));\n"
+            retStr += f"\t\t{argName} = static_cast<char *>(marshalArena.allocate({argName}Length));\n"
             retStr += f"\t\t{argName}Status = mxGetString(argv[{position}], {argName}, {argName}Length);\n\n"
             retStr += "\t}\n"
             return retStr
@@ -617,7 +1673,7 @@ class MatlabBindingGenerator(object):
         def initializeArgDouble(argName: str, position: int, functionName: str) -> str:
             retStr = f"\tif(!mxIsNumeric(argv[{position}])){{\n"
             retStr += "\t\tmexUnlock();\n"
-            retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type double.\");\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type double.\");\n"
             retStr += "\t}\n"
             retStr += f"\tdouble {argName} = mxGetScalar(argv[{position}]);\n\n"
             return retStr
@@ -626,7 +1682,7 @@ class MatlabBindingGenerator(object):
         def initializeArgInt(argName: str, position: int, functionName: str) -> str:
             retStr = f"\tif(!mxIsNumeric(argv[{position}])){{\n"
             retStr += "\t\tmexUnlock();\n"
-            retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type integer.\");\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type integer.\");\n"
             retStr += "\t}\n"
             retStr += f"\t\tint {argName} = static_cast<int>(mxGetScalar(argv[{position}]));\n\n"
             
@@ -636,7 +1692,7 @@ class MatlabBindingGenerator(object):
         def initializeArgVoidPtr(argName: str, position: int, functionName: str) -> str:
             retStr = f"\tif(mxGetClassID(argv[{position}]) != mxUINT64_CLASS){{\n"
             retStr += "\t\tmexUnlock();\n"
-            retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type uint64.\");\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type uint64.\");\n"
             retStr += "\t}\n"
             retStr += f"\t\tvoid *{argName} = mxGetData(argv[{position}]);\n\n"
             return retStr
@@ -655,11 +1711,11 @@ class MatlabBindingGenerator(object):
             retStr += f"\t\t\tp{argName} = mxGetLogicals(logical{argName});\n"
             retStr += "\t\t} else {\n"
             retStr += "\t\t\tmexUnlock();\n"
-            retStr += f"\t\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be a logical type or a 0 or 1.\");\n"
+            retStr += f"\t\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be a logical type or a 0 or 1.\");\n"
             retStr += "\t\t}\n"
             retStr += "\t} else {\n"
             retStr += "\t\tmexUnlock();\n"
-            retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be a logical type or a 0 or 1.\");\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be a logical type or a 0 or 1.\");\n"
             retStr += "\t}\n"
             retStr += f"\tHelicsBool {argName} = HELICS_FALSE;\n"
             retStr += f"\tif(p{argName}[0]){{\n"
@@ -671,7 +1727,7 @@ class MatlabBindingGenerator(object):
         def initializeArgHelicsClass(helicsClass: str, argName: str, position: int, functionName: str) -> str:
             retStr = f"\tif(mxGetClassID(argv[{position}]) != mxUINT64_CLASS){{\n"
             retStr += "\t\tmexUnlock();\n"
-            retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type uint64.\");\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type uint64.\");\n"
             retStr += "\t}\n"
             retStr += f"\t{helicsClass} {argName} = *(static_cast<{helicsClass}*>(mxGetData(argv[{position}])));\n\n"
             return retStr
@@ -680,7 +1736,7 @@ class MatlabBindingGenerator(object):
         def initializeArgHelicsEnum(helicsEnum: str, argName: str, position: int, functionName: str) -> str:
             retStr = f"\tif(!mxIsNumeric(argv[{position}])){{\n"
             retStr += "\t\tmexUnlock();\n"
-            retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type int32.\");\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type int32.\");\n"
             retStr += "\t}\n"
             retStr += f"\tint {argName}Int = static_cast<int>(mxGetScalar(argv[{position}]));\n"
             retStr += f"\t{helicsEnum} {argName} = static_cast<{helicsEnum}>({argName}Int);\n\n"
@@ -695,7 +1751,7 @@ class MatlabBindingGenerator(object):
         def initializeArgHelicsTime(argName: str, position: int, functionName: str) -> str:
             retStr = f"\tif(!mxIsNumeric(argv[{position}])){{\n"
             retStr += "\t\tmexUnlock();\n"
-            retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type double.\");\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type double.\");\n"
             retStr += "\t}\n"
             retStr += f"\tHelicsTime {argName} = (HelicsTime)(mxGetScalar(argv[{position}]));\n\n"
             return retStr
@@ -704,7 +1760,7 @@ class MatlabBindingGenerator(object):
         def initializeArgInt32_t(argName: str, position: int, functionName: str) -> str:
             retStr = f"\tif(mxGetClassID(argv[{position}]) != mxINT32_CLASS){{\n"
             retStr += "\t\tmexUnlock();\n"
-            retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type int32.\");\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type int32.\");\n"
             retStr += "\t}\n"
             retStr += f"\tmxInt32 *p{argName} = mxGetInt32s(argv[{position}]);\n"
             retStr += f"\tint32_t {argName} = static_cast<int32_t>(p{argName}[0]);\n\n"
@@ -714,7 +1770,7 @@ class MatlabBindingGenerator(object):
         def initializeArgInt64_t(argName: str, position: int, functionName: str) -> str:
             retStr = f"\tif(mxGetClassID(argv[{position}]) != mxINT64_CLASS){{\n"
             retStr += "\t\tmexUnlock();\n"
-            retStr += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type int64.\");\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be of type int64.\");\n"
             retStr += "\t}\n"
             retStr += f"\tmxInt64 *p{argName} = mxGetInt64s(argv[{position}]);\n"
             retStr += f"\tint64_t {argName} = static_cast<int64_t>(p{argName}[0]);\n\n"
@@ -806,8 +1862,14 @@ class MatlabBindingGenerator(object):
             return retStr
         
         
-        def argCharPostFunctionCall(argName: str) -> str:
-            return f"\tfree({argName});"
+        def initializeArgBytes(argName: str, position: int, functionName: str) -> str:
+            retStr = f"\tif(!mxIsChar(argv[{position}]) && !mxIsUint8(argv[{position}])){{\n"
+            retStr += "\t\tmexUnlock();\n"
+            retStr += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument {position+1} must be a string or an array of type uint8.\");\n"
+            retStr += "\t}\n"
+            retStr += f"\tint inputDataLength = 0;\n"
+            retStr += f"\tconst void *{argName} = getBytePayload(argv[{position}], &inputDataLength);\n\n"
+            return retStr
         
         
         def argHelicsErrorPtrPostFunctionCall(argName: str) -> str:
@@ -851,6 +1913,7 @@ class MatlabBindingGenerator(object):
                 "helicsInputSetDefaultComplexVector": helicsInputSetDefaultComplexVectorMatlabWrapper,
                 "helicsMessageAppendData": helicsMessageAppendDataMatlabWrapper,
                 "helicsMessageGetBytes": helicsMessageGetBytesMatlabWrapper,
+                "helicsMessageGetBytesPointer": helicsMessageGetBytesPointerMatlabWrapper,
                 "helicsMessageSetData": helicsMessageSetDataMatlabWrapper,
                 "helicsPublicationPublishBytes": helicsPublicationPublishBytesMatlabWrapper,
                 "helicsPublicationPublishComplex": helicsPublicationPublishComplexMatlabWrapper,
@@ -893,7 +1956,7 @@ class MatlabBindingGenerator(object):
             with open(os.path.join(self.__rootDir, f'matlabBindings/+helics/{functionDict.get("spelling","")}.m'), "w") as functionMFile:
                 functionMFile.write(f'function varargout = {functionDict.get("spelling","")}(varargin)\n')
                 functionMFile.write(functionComment)
-                functionMFile.write("\t[varargout{1:nargout}] = helicsMex(" + f'\'{functionDict.get("spelling","")}\', varargin' + "{:});\n")
+                functionMFile.write("\t[varargout{1:nargout}] = helicsMex(" + f"int32({cursorIdx}), varargin" + "{:});\n")
                 functionMFile.write("end\n")
             return functionWrapper, functionMainElement, (functionDict.get("spelling",""), cursorIdx)
         
@@ -927,7 +1990,7 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 3){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgChar("type", 0, functionName)
             functionWrapper += initializeArgChar("name", 1, functionName)
@@ -936,26 +1999,24 @@ class MatlabBindingGenerator(object):
             functionWrapper += "\tint ii;\n"
             functionWrapper += f"\tif(!mxIsCell(argv[2])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 3 must be a cell array of strings.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 3 must be a cell array of strings.\");\n"
             functionWrapper += "\t}\n"
             functionWrapper += "\targ2 = static_cast<int>(mxGetNumberOfElements(argv[2]));\n"
-            functionWrapper += "\targ3 = static_cast<char **>(malloc((arg2)*sizeof(char *)));\n"
+            functionWrapper += "\targ3 = static_cast<char **>(marshalArena.allocate((arg2)*sizeof(char *)));\n"
             functionWrapper += "\tfor (ii=0;ii<arg2;ii++){\n"
             functionWrapper += "\t\tmxArray *cellElement=mxGetCell(argv[2], ii);\n"
             functionWrapper += "\t\tsize_t len = mxGetN(cellElement) + 1;\n"
-            functionWrapper += "\t\targ3[ii] = static_cast<char *>(malloc(static_cast<int>(len)));\n"
+            functionWrapper += "\t\targ3[ii] = static_cast<char *>(marshalArena.allocate(len));\n"
             functionWrapper += "\t\tint flag = mxGetString(cellElement, arg3[ii], static_cast<int>(len));\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\tHelicsCore result = {functionName}(type, name, arg2, arg3, &err);\n\n"
+            functionWrapper += "\ttrackHelicsObject(HELICS_MEX_CORE, result);\n\n"
             functionWrapper += returnVoidPtrTomxArray()
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("type")}\n\n'
-            functionWrapper += f'{argCharPostFunctionCall("name")}\n\n'
-            functionWrapper += f'{argCharPostFunctionCall("arg3")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -993,35 +2054,33 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 3){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgChar("type", 0, functionName)
             functionWrapper += initializeArgChar("name", 1, functionName)
             functionWrapper += f"\tif(!mxIsCell(argv[2])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 3 must be a cell array of strings.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 3 must be a cell array of strings.\");\n"
             functionWrapper += "\t}\n"
             functionWrapper += "\tint arg2 = 0;\n"
             functionWrapper += "\tchar **arg3;\n"
             functionWrapper += "\tint ii;\n"
             functionWrapper += "\targ2 = static_cast<int>(mxGetNumberOfElements(argv[2]));\n"
-            functionWrapper += "\targ3 = static_cast<char **>(malloc((arg2)*sizeof(char *)));\n"
+            functionWrapper += "\targ3 = static_cast<char **>(marshalArena.allocate((arg2)*sizeof(char *)));\n"
             functionWrapper += "\tfor (ii=0;ii<arg2;ii++){\n"
             functionWrapper += "\t\tmxArray *cellElement=mxGetCell(argv[2], ii);\n"
             functionWrapper += "\t\tsize_t len = mxGetN(cellElement) + 1;\n"
-            functionWrapper += "\t\targ3[ii] = static_cast<char *>(malloc(static_cast<int>(len)));\n"
+            functionWrapper += "\t\targ3[ii] = static_cast<char *>(marshalArena.allocate(len));\n"
             functionWrapper += "\t\tint flag = mxGetString(cellElement, arg3[ii], static_cast<int>(len));\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\tHelicsBroker result = {functionName}(type, name, arg2, arg3, &err);\n\n"
+            functionWrapper += "\ttrackHelicsObject(HELICS_MEX_BROKER, result);\n\n"
             functionWrapper += returnVoidPtrTomxArray()
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("type")}\n\n'
-            functionWrapper += f'{argCharPostFunctionCall("name")}\n\n'
-            functionWrapper += f'{argCharPostFunctionCall("arg3")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1054,22 +2113,22 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederateInfo", "fedInfo", 0, functionName)
             functionWrapper += f"\tif(!mxIsCell(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be of cell array of strings.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be of cell array of strings.\");\n"
             functionWrapper += "\t}\n"
             functionWrapper += "\tint arg1 = 0;\n"
             functionWrapper += "\tchar **arg2;\n"
             functionWrapper += "\tint ii;\n"
             functionWrapper += "\targ1 = static_cast<int>(mxGetNumberOfElements(argv[1]));\n"
-            functionWrapper += "\targ2 = static_cast<char **>(malloc((arg1)*sizeof(char *)));\n"
+            functionWrapper += "\targ2 = static_cast<char **>(marshalArena.allocate((arg1)*sizeof(char *)));\n"
             functionWrapper += "\tfor (ii=0;ii<arg1;ii++){\n"
             functionWrapper += "\t\tmxArray *cellElement=mxGetCell(argv[1], ii);\n"
             functionWrapper += "\t\tsize_t len = mxGetN(cellElement) + 1;\n"
-            functionWrapper += "\t\targ2[ii] = static_cast<char *>(malloc(static_cast<int>(len)));\n"
+            functionWrapper += "\t\targ2[ii] = static_cast<char *>(marshalArena.allocate(len));\n"
             functionWrapper += "\t\tint flag = mxGetString(cellElement, arg2[ii], static_cast<int>(len));\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
@@ -1079,7 +2138,6 @@ class MatlabBindingGenerator(object):
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("arg2")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1112,19 +2170,17 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsEndpoint", "endpoint", 0, functionName)
-            functionWrapper += initializeArgChar("data", 1, functionName)
-            functionWrapper += "\tint inputDataLength = (int)(dataLength - 1);\n\n"
+            functionWrapper += initializeArgBytes("data", 1, functionName)
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(endpoint, (void *)data, inputDataLength, &err);\n\n"
+            functionWrapper += f"\t{functionName}(endpoint, data, inputDataLength, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("data")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1161,20 +2217,18 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 3){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsEndpoint", "endpoint", 0, functionName)
-            functionWrapper += initializeArgChar("data", 1, functionName)
-            functionWrapper += "\tint inputDataLength = (int)(dataLength - 1);\n\n"
+            functionWrapper += initializeArgBytes("data", 1, functionName)
             functionWrapper += initializeArgHelicsTime("time", 2, functionName)
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(endpoint, (void *)data, inputDataLength, time, &err);\n\n"
+            functionWrapper += f"\t{functionName}(endpoint, data, inputDataLength, time, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("data")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1211,21 +2265,18 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 3){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsEndpoint", "endpoint", 0, functionName)
-            functionWrapper += initializeArgChar("data", 1, functionName)
-            functionWrapper += "\tint inputDataLength = (int)(dataLength - 1);\n\n"
+            functionWrapper += initializeArgBytes("data", 1, functionName)
             functionWrapper += initializeArgChar("dst", 2, functionName)
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(endpoint, (void *)data, inputDataLength, dst, &err);\n\n"
+            functionWrapper += f"\t{functionName}(endpoint, data, inputDataLength, dst, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("data")}\n\n'
-            functionWrapper += f'{argCharPostFunctionCall("dst")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1266,22 +2317,19 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 4){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 4 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 4 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsEndpoint", "endpoint", 0, functionName)
-            functionWrapper += initializeArgChar("data", 1, functionName)
-            functionWrapper += "\tint inputDataLength = (int)(dataLength - 1);\n\n"
+            functionWrapper += initializeArgBytes("data", 1, functionName)
             functionWrapper += initializeArgChar("dst", 2, functionName)
             functionWrapper += initializeArgHelicsTime("time", 3, functionName)
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(endpoint, (void *)data, inputDataLength, dst, time, &err);\n\n"
+            functionWrapper += f"\t{functionName}(endpoint, data, inputDataLength, dst, time, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("data")}\n\n'
-            functionWrapper += f'{argCharPostFunctionCall("dst")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1321,14 +2369,14 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 3){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
             functionWrapper += initializeArgHelicsTime("requestTime", 1, functionName)
             functionWrapper += initializeArgHelicsEnum("HelicsIterationRequest", "iterate", 2, functionName)
             functionWrapper += initializeArgHelicsIterationResultPtr("outIteration")
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\tHelicsTime result = {functionName}(fed, requestTime, iterate, &outIteration, &err);\n\n"
+            functionWrapper += f"\tHelicsTime result = {functionName}PumpingCallbacks(fed, requestTime, iterate, &outIteration, &err);\n\n"
             functionWrapper += returnDoubleTomxArray()
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
@@ -1369,12 +2417,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
             functionWrapper += initializeArgHelicsIterationResultPtr("outIteration")
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\tHelicsTime result = {functionName}(fed, &outIteration, &err);\n\n"
+            functionWrapper += f"\tHelicsTime result = {functionName}PumpingCallbacks(fed, &outIteration, &err);\n\n"
             functionWrapper += returnDoubleTomxArray()
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
@@ -1421,15 +2469,15 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
             functionWrapper += "\tint maxDataLen = helicsInputGetByteCount(ipt) + 2;\n\n"
-            functionWrapper += "\tvoid *data = malloc(maxDataLen);\n\n"
+            functionWrapper += "\tvoid *data = marshalArena.allocate(maxDataLen);\n\n"
             functionWrapper += "\tint actualSize = 0;\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(ipt, data, maxDataLen, &actualSize, &err);\n\n"
-            functionWrapper += "\tmxChar *dataChar = static_cast<mxChar *>(data);\n"
+            functionWrapper += "\tunsigned char *dataChar = static_cast<unsigned char *>(data);\n"
             functionWrapper += "\tmwSize dims[2] = {1, static_cast<mwSize>(actualSize)};\n"
             functionWrapper += "\tmxArray *_out = mxCreateCharArray(2, dims);\n"
             functionWrapper += "\tmxChar *out_data = static_cast<mxChar *>(mxGetData(_out));\n"
@@ -1440,7 +2488,6 @@ class MatlabBindingGenerator(object):
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("data")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1467,7 +2514,7 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
             functionWrapper += initializeArgHelicsErrorPtr("err")
@@ -1513,7 +2560,7 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
             functionWrapper += "\tdouble values[2];\n\n"
@@ -1565,11 +2612,11 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
             functionWrapper += "\tint maxStringLen = helicsInputGetStringSize(ipt) + 2;\n\n"
-            functionWrapper += "\tchar *outputString = static_cast<char *>(malloc(maxStringLen));\n\n"
+            functionWrapper += "\tchar *outputString = static_cast<char *>(marshalArena.allocate(maxStringLen));\n\n"
             functionWrapper += "\tint actualLength = 0;\n\n"
             functionWrapper += "\tdouble val = 0;\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
@@ -1588,7 +2635,6 @@ class MatlabBindingGenerator(object):
             functionWrapper += "\t\tmxArray *_out1 = mxCreateDoubleScalar(val);\n"
             functionWrapper += "\t\t*resv++ = _out1;\n"
             functionWrapper += "\t}\n\n" 
-            functionWrapper += f'{argCharPostFunctionCall("outputString")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1624,11 +2670,11 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
             functionWrapper += "\tint maxStringLen = helicsInputGetStringSize(ipt) + 2;\n\n"
-            functionWrapper += "\tchar *outputString = static_cast<char *>(malloc(maxStringLen));\n\n"
+            functionWrapper += "\tchar *outputString = static_cast<char *>(marshalArena.allocate(maxStringLen));\n\n"
             functionWrapper += "\tint actualLength = 0;\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(ipt, outputString, maxStringLen, &actualLength, &err);\n\n"
@@ -1642,7 +2688,6 @@ class MatlabBindingGenerator(object):
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("outputString")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1678,20 +2723,15 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
             functionWrapper += "\tint maxLength = helicsInputGetVectorSize(ipt);\n\n"
-            functionWrapper += "\tdouble *data = static_cast<double *>(malloc(maxLength * sizeof(double)));\n\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleMatrix(maxLength, 1, mxREAL);\n\n"
             functionWrapper += "\tint actualSize = 0;\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(ipt, data, maxLength, &actualSize, &err);\n\n"
-            functionWrapper += "\tmxDouble *result_data = static_cast<mxDouble *>(mxMalloc(actualSize * sizeof(mxDouble)));\n"
-            functionWrapper += "\tfor(int i=0; i<actualSize; ++i){\n"
-            functionWrapper += "\t\tresult_data[i] = static_cast<mxDouble>(data[i]);\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += "\tmxArray *_out = mxCreateDoubleMatrix(actualSize, 1, mxREAL);\n"
-            functionWrapper += "\tint status = mxSetDoubles(_out, &(result_data[0]));\n\n"
+            functionWrapper += f"\t{functionName}(ipt, mxGetDoubles(_out), maxLength, &actualSize, &err);\n\n"
+            functionWrapper += "\tmxSetM(_out, actualSize);\n\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -1731,21 +2771,15 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
             functionWrapper += "\tint maxLength = helicsInputGetVectorSize(ipt);\n\n"
-            functionWrapper += "\tdouble *data = static_cast<double *>(malloc(maxLength * sizeof(double)));\n\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleMatrix(maxLength/2, 1, mxCOMPLEX);\n\n"
             functionWrapper += "\tint actualSize = 0;\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(ipt, data, maxLength, &actualSize, &err);\n\n"
-            functionWrapper += "\tmxComplexDouble *result_data = static_cast<mxComplexDouble *>(mxMalloc((actualSize/2)*sizeof(mxComplexDouble)));\n"
-            functionWrapper += "\tfor(int i=0; i<(actualSize/2); ++i){\n"
-            functionWrapper += "\t\tresult_data[i].real = data[2*(i)];\n"
-            functionWrapper += "\t\tresult_data[i].imag = data[2*(i) + 1];\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += "\tmxArray *_out = mxCreateDoubleMatrix(actualSize/2, 1, mxCOMPLEX);\n"
-            functionWrapper += "\tint status = mxSetComplexDoubles(_out, &(result_data[0]));\n\n"
+            functionWrapper += f"\t{functionName}(ipt, reinterpret_cast<double *>(mxGetComplexDoubles(_out)), 2*(maxLength/2), &actualSize, &err);\n\n"
+            functionWrapper += "\tmxSetM(_out, actualSize/2);\n\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -1782,19 +2816,17 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
-            functionWrapper += initializeArgChar("data", 1, functionName)
-            functionWrapper += "\tint inputDataLength = static_cast<int>(dataLength) - 1;\n\n"
+            functionWrapper += initializeArgBytes("data", 1, functionName)
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(ipt, static_cast<void *>(data), inputDataLength, &err);\n\n"
+            functionWrapper += f"\t{functionName}(ipt, data, inputDataLength, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("data")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -1827,12 +2859,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
             functionWrapper += f"\tif(!mxIsComplex(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be of type complex.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be of type complex.\");\n"
             functionWrapper += "\t}\n"
             functionWrapper += "\tmxComplexDouble *value = mxGetComplexDoubles(argv[1]);\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
@@ -1874,12 +2906,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
             functionWrapper += f"\tif(!mxIsNumeric(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be an array of doubles.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be an array of doubles.\");\n"
             functionWrapper += "\t}\n"
             functionWrapper += "\tint vectorLength =  static_cast<int>(mxGetNumberOfElements(argv[1]));\n\n"
             functionWrapper += "\tdouble *vectorInput =  static_cast<double *>(mxGetDoubles(argv[1]));\n\n"
@@ -1922,22 +2954,17 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsInput", "ipt", 0, functionName)
-            functionWrapper += f"\tif(!mxIsComplex(argv[1])){{\n"
+            functionWrapper += f"\tif(!mxIsDouble(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be of an array of type complex.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be an array of type complex or double.\");\n"
             functionWrapper += "\t}\n"
-            functionWrapper += "\tint vectorLength =  static_cast<int>(mxGetN(argv[1])*2);\n\n"
-            functionWrapper += "\tdouble *vectorInput = static_cast<double *>(malloc(vectorLength * sizeof(double)));\n"
-            functionWrapper += "\tmxComplexDouble *vals = mxGetComplexDoubles(argv[1]);\n"
-            functionWrapper += "\tfor(int i=0; i<vectorLength/2; ++i){\n"
-            functionWrapper += "\t\tvectorInput[2*i] = vals[i].real;\n"
-            functionWrapper += "\t\tvectorInput[2*i + 1] = vals[i].imag;\n"
-            functionWrapper += "\t}\n\n"
+            functionWrapper += "\tint vectorLength = static_cast<int>(mxGetNumberOfElements(argv[1])*2);\n\n"
+            functionWrapper += "\tconst double *vectorInput = getInterleavedComplexData(argv[1]);\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(ipt, static_cast<const double *>(vectorInput), vectorLength, &err);\n\n"
+            functionWrapper += f"\t{functionName}(ipt, vectorInput, vectorLength, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
@@ -1975,13 +3002,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsMessage", "message", 0, functionName)
-            functionWrapper += initializeArgChar("data", 1, functionName)
-            functionWrapper += "\tint inputDataLength = static_cast<int>(dataLength) - 1;\n\n"
+            functionWrapper += initializeArgBytes("data", 1, functionName)
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(message, static_cast<void *>(data), inputDataLength, &err);\n\n"
+            functionWrapper += f"\t{functionName}(message, data, inputDataLength, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
@@ -2022,11 +3048,11 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsMessage", "message", 0, functionName)
             functionWrapper += "\tint maxMessageLength = helicsMessageGetByteCount(message) + 2;\n\n"
-            functionWrapper += "\tchar *data = static_cast<char *>(malloc(maxMessageLength));\n\n"
+            functionWrapper += "\tchar *data = static_cast<char *>(marshalArena.allocate(maxMessageLength));\n\n"
             functionWrapper += "\tint actualSize = 0;\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(message, static_cast<void *>(data), maxMessageLength, &actualSize, &err);\n\n"
@@ -2034,13 +3060,12 @@ class MatlabBindingGenerator(object):
             functionWrapper += "\tmxArray *_out = mxCreateCharArray(2,dims);\n"
             functionWrapper += "\tmxChar *out_data = static_cast<mxChar*>(mxGetData(_out));\n"
             functionWrapper += "\tfor(int i=0; i<actualSize; ++i){\n"
-            functionWrapper += "\t\tout_data[i] = data[i];\n"
+            functionWrapper += "\t\tout_data[i] = static_cast<unsigned char>(data[i]);\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("data")}\n\n'
             functionWrapper += f'{argHelicsErrorPtrPostFunctionCall("err")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
@@ -2049,6 +3074,59 @@ class MatlabBindingGenerator(object):
             return functionComment, functionWrapper, functionMainElements
         
         
+        def helicsMessageGetBytesPointerMatlabWrapper(functionDict: Dict[str,str], cursorIdx: int):
+            #check to see if function signiture changed
+            argNum = len(functionDict.get("arguments", {}).keys())
+            if argNum != 1:
+                raise RuntimeError("the function signature for helicsMessageGetBytesPointer has changed!")
+            arg0 = functionDict.get("arguments", {}).get(0, {})
+            if arg0.get("spelling","") != "message" or arg0.get("type", "") != "HelicsMessage":
+                raise RuntimeError("the function signature for helicsMessageGetBytesPointer has changed!")
+            functionName = functionDict.get("spelling","")
+            functionComment = "% Get a pointer to the raw data of a message.\n% \n"
+            functionComment += "% @param message A message object to get the data for.\n"
+            functionComment += "% @param asArray Optional, true to return the payload itself as a uint8 row vector filled with a single copy\n"
+            functionComment += "%        instead of its address (default false).\n% \n"
+            functionComment += "% @return A pointer to the raw data in memory, the pointer may be NULL if the message is not a valid message.\n\n"
+            functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
+            functionWrapper += f"\tif(argc < 1 || argc > 2){{\n"
+            functionWrapper += "\t\tmexUnlock();\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires at least 1 arguments and at most 2 arguments.\");\n"
+            functionWrapper += "\t}\n\n"
+            functionWrapper += initializeArgHelicsClass("HelicsMessage", "message", 0, functionName)
+            functionWrapper += "\tbool asArray = false;\n"
+            functionWrapper += "\tif(argc > 1){\n"
+            functionWrapper += "\t\tif(!mxIsLogical(argv[1]) && !mxIsNumeric(argv[1])){\n"
+            functionWrapper += "\t\t\tmexUnlock();\n"
+            functionWrapper += f"\t\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be a logical type or a 0 or 1.\");\n"
+            functionWrapper += "\t\t}\n"
+            functionWrapper += "\t\tasArray = (mxGetScalar(argv[1]) != 0.0);\n"
+            functionWrapper += "\t}\n\n"
+            functionWrapper += f"\tvoid *result = {functionName}(message);\n\n"
+            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tif(asArray){\n"
+            functionWrapper += "\t\t/* MATLAB can only adopt memory from mxMalloc so the payload is copied once straight from the message buffer */\n"
+            functionWrapper += "\t\tint byteCount = (result != nullptr) ? helicsMessageGetByteCount(message) : 0;\n"
+            functionWrapper += "\t\t_out = mxCreateUninitNumericMatrix(1, byteCount, mxUINT8_CLASS, mxREAL);\n"
+            functionWrapper += "\t\tif(byteCount > 0){\n"
+            functionWrapper += "\t\t\tmemcpy(mxGetUint8s(_out), result, byteCount);\n"
+            functionWrapper += "\t\t}\n"
+            functionWrapper += "\t}else{\n"
+            functionWrapper += "\t\t_out = mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL);\n"
+            functionWrapper += "\t\tmxUint64 *rv = mxGetUint64s(_out);\n"
+            functionWrapper += "\t\trv[0] = reinterpret_cast<mxUint64>(result);\n"
+            functionWrapper += "\t}\n\n"
+            functionWrapper += "\tif(_out){\n"
+            functionWrapper += "\t\t--resc;\n"
+            functionWrapper += "\t\t*resv++ = _out;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "}\n\n\n"
+            functionMainElements = f"\tcase {cursorIdx}:\n"
+            functionMainElements += f"\t\t_wrap_{functionName}(resc, resv, argc, argv);\n"
+            functionMainElements += f"\t\tbreak;\n"
+            return functionComment, functionWrapper, functionMainElements
+        
+        
         def helicsMessageSetDataMatlabWrapper(functionDict: Dict[str,str], cursorIdx: int):
             #check to see if function signiture changed
             argNum = len(functionDict.get("arguments", {}).keys())
@@ -2073,13 +3151,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsMessage", "message", 0, functionName)
-            functionWrapper += initializeArgChar("data", 1, functionName)
-            functionWrapper += "\tint inputDataLength = static_cast<int>(dataLength) - 1;\n\n"
+            functionWrapper += initializeArgBytes("data", 1, functionName)
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(message, static_cast<void *>(data), inputDataLength, &err);\n\n"
+            functionWrapper += f"\t{functionName}(message, data, inputDataLength, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
@@ -2117,13 +3194,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsPublication", "pub", 0, functionName)
-            functionWrapper += initializeArgChar("data", 1, functionName)
-            functionWrapper += "\tint inputDataLength = static_cast<int>(dataLength) - 1;\n\n"
+            functionWrapper += initializeArgBytes("data", 1, functionName)
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(pub, static_cast<void *>(data), inputDataLength, &err);\n\n"
+            functionWrapper += f"\t{functionName}(pub, data, inputDataLength, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
@@ -2161,12 +3237,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsPublication", "pub", 0, functionName)
             functionWrapper += f"\tif(!mxIsComplex(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be of type complex.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be of type complex.\");\n"
             functionWrapper += "\t}\n"
             functionWrapper += "\tmxComplexDouble *complexValue = mxGetComplexDoubles(argv[1]);\n"
             functionWrapper += "\tdouble value[2] = {complexValue[0].real, complexValue[0].imag};\n\n"
@@ -2209,12 +3285,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsPublication", "pub", 0, functionName)
             functionWrapper += f"\tif(!mxIsNumeric(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be an array of type double.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be an array of type double.\");\n"
             functionWrapper += "\t}\n"
             functionWrapper += "\tint vectorLength =  static_cast<int>(mxGetNumberOfElements(argv[1]));\n\n"
             functionWrapper += "\tdouble *vectorInput =  static_cast<double *>(mxGetDoubles(argv[1]));\n\n"
@@ -2257,22 +3333,17 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsPublication", "pub", 0, functionName)
-            functionWrapper += f"\tif(!mxIsComplex(argv[1])){{\n"
+            functionWrapper += f"\tif(!mxIsDouble(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be an array of type complex.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be an array of type complex or double.\");\n"
             functionWrapper += "\t}\n"
-            functionWrapper += "\tint vectorLength =  static_cast<int>(mxGetN(argv[1])*2);\n\n"
-            functionWrapper += "\tdouble *vectorInput = static_cast<double *>(malloc(vectorLength * sizeof(double)));\n"
-            functionWrapper += "\tmxComplexDouble *vals = mxGetComplexDoubles(argv[1]);\n"
-            functionWrapper += "\tfor(int i=0; i<vectorLength/2; ++i){\n"
-            functionWrapper += "\t\tvectorInput[2*i] = vals[i].real;\n"
-            functionWrapper += "\t\tvectorInput[2*i + 1] = vals[i].imag;\n"
-            functionWrapper += "\t}\n\n"
+            functionWrapper += "\tint vectorLength = static_cast<int>(mxGetNumberOfElements(argv[1])*2);\n\n"
+            functionWrapper += "\tconst double *vectorInput = getInterleavedComplexData(argv[1]);\n\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
-            functionWrapper += f"\t{functionName}(pub, static_cast<const double *>(vectorInput), vectorLength, &err);\n\n"
+            functionWrapper += f"\t{functionName}(pub, vectorInput, vectorLength, &err);\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
@@ -2311,7 +3382,7 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsQueryBuffer", "buffer", 0, functionName)
             functionWrapper += initializeArgChar("queryResult", 1, functionName)
@@ -2362,30 +3433,36 @@ class MatlabBindingGenerator(object):
             functionComment += "%\t@param broker The broker object in which to set the callback.\n"
             functionComment += "%\t@param logger A function handle with the signature void(int loglevel, string identifier, string message).\n"
             functionWrapper = "void matlabBrokerLoggingCallback(int loglevel, const char* identifier, const char* message, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[4];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxInt64 *rhs1Ptr = mxGetInt64s(rhs[1]);\n"
-            functionWrapper += "\trhs1Ptr[0] = static_cast<mxInt64>(loglevel);\n"
-            functionWrapper += "\trhs[2] = mxCreateString(identifier);\n"
-            functionWrapper += "\trhs[3] = mxCreateString(message);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,4,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[3]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tstd::string identifierCopy(identifier);\n"
+            functionWrapper += "\t\tstd::string messageCopy(message);\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabBrokerLoggingCallback(loglevel, identifierCopy.c_str(), messageCopy.c_str(), userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetInt64s(callback.rhs[1])[0] = static_cast<mxInt64>(loglevel);\n"
+            functionWrapper += "\tcallback.rhs[2] = mxCreateString(identifier);\n"
+            functionWrapper += "\tcallback.rhs[3] = mxCreateString(message);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsBroker", "broker", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsBrokerSetLoggingCallback\", broker, argv[1], {mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL), nullptr, nullptr});\n"
+            functionWrapper += "\tuserData->detach = [broker](HelicsError *err){ helicsBrokerSetLoggingCallback(broker, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(broker, &matlabBrokerLoggingCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2421,30 +3498,36 @@ class MatlabBindingGenerator(object):
             functionComment += "%\t@param core The core object in which to set the callback.\n"
             functionComment += "%\t@param logger A function handle with the signature void(int loglevel, string identifier, string message).\n"
             functionWrapper = "void matlabCoreLoggingCallback(int loglevel, const char* identifier, const char* message, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[4];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxInt64 *rhs1Ptr = mxGetInt64s(rhs[1]);\n"
-            functionWrapper += "\trhs1Ptr[0] = static_cast<mxInt64>(loglevel);\n"
-            functionWrapper += "\trhs[2] = mxCreateString(identifier);\n"
-            functionWrapper += "\trhs[3] = mxCreateString(message);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,4,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[3]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tstd::string identifierCopy(identifier);\n"
+            functionWrapper += "\t\tstd::string messageCopy(message);\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabCoreLoggingCallback(loglevel, identifierCopy.c_str(), messageCopy.c_str(), userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetInt64s(callback.rhs[1])[0] = static_cast<mxInt64>(loglevel);\n"
+            functionWrapper += "\tcallback.rhs[2] = mxCreateString(identifier);\n"
+            functionWrapper += "\tcallback.rhs[3] = mxCreateString(message);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsCore", "core", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsCoreSetLoggingCallback\", core, argv[1], {mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL), nullptr, nullptr});\n"
+            functionWrapper += "\tuserData->detach = [core](HelicsError *err){ helicsCoreSetLoggingCallback(core, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(core, &matlabCoreLoggingCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2480,30 +3563,36 @@ class MatlabBindingGenerator(object):
             functionComment += "%\t@param fed The federate object in which to set the callback.\n"
             functionComment += "%\t@param logger A function handle with the signature void(int loglevel, string identifier, string message).\n"
             functionWrapper = "void matlabFederateLoggingCallback(int loglevel, const char* identifier, const char* message, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[4];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxInt64 *rhs1Ptr = mxGetInt64s(rhs[1]);\n"
-            functionWrapper += "\trhs1Ptr[0] = static_cast<mxInt64>(loglevel);\n"
-            functionWrapper += "\trhs[2] = mxCreateString(identifier);\n"
-            functionWrapper += "\trhs[3] = mxCreateString(message);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,4,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[3]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tstd::string identifierCopy(identifier);\n"
+            functionWrapper += "\t\tstd::string messageCopy(message);\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabFederateLoggingCallback(loglevel, identifierCopy.c_str(), messageCopy.c_str(), userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetInt64s(callback.rhs[1])[0] = static_cast<mxInt64>(loglevel);\n"
+            functionWrapper += "\tcallback.rhs[2] = mxCreateString(identifier);\n"
+            functionWrapper += "\tcallback.rhs[3] = mxCreateString(message);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateSetLoggingCallback\", fed, argv[1], {mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL), nullptr, nullptr});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsFederateSetLoggingCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabFederateLoggingCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2535,31 +3624,49 @@ class MatlabBindingGenerator(object):
                 raise RuntimeError("the function signature for helicsFilterSetCustomCallback has changed!")
             functionName = functionDict.get("spelling","")
             functionComment = "%\tSet a general callback for a custom filter.\n\n"
-            functionComment += "%\t@details Add a custom filter callback function for creating a custom filter operation in the c shared library.\n\n"
+            functionComment += "%\t@details Add a custom filter callback function for creating a custom filter operation in the c shared library.\n"
+            functionComment += "%\tThe callback runs only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),\n"
+            functionComment += "%\tHELICS waits for it for at most the time set with helicsCallbackSetTimeout and then passes the message through unchanged.\n\n"
             functionComment += "%\t@param filter The filter object in which to set the callback.\n"
             functionComment += "%\t@param filtCall A function handle with the signature HelicsMessage(HelicsMessage message).\n"
             functionWrapper = "HelicsMessage matlabFilterCustomCallback(HelicsMessage message, void *userData){\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tHelicsMessage rv = message;\n"
+            functionWrapper += "\t\tif(!runCallbackOnMatlabThread([&](){ rv = matlabFilterCustomCallback(message, userData); })){\n"
+            functionWrapper += "\t\t\t++static_cast<helicsMexCallback *>(userData)->timeouts;\n"
+            functionWrapper += "\t\t}\n"
+            functionWrapper += "\t\treturn rv;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn message;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetUint64s(callback.rhs[1])[0] = reinterpret_cast<mxUint64>(message);\n"
             functionWrapper += "\tmxArray *lhs[1];\n"
-            functionWrapper += "\tmxArray *rhs[2];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxUint64 *rhs1Ptr = mxGetUint64s(rhs[1]);\n"
-            functionWrapper += "\trhs1Ptr[0] = reinterpret_cast<mxUint64>(message);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(1,lhs,2,rhs,"feval");\n'
-            functionWrapper += "\tHelicsMessage rv = static_cast<HelicsMessage>(mxGetData(lhs[0]));\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
+            functionWrapper += "\tif(callback.call(1, lhs) != 0){\n"
+            functionWrapper += "\t\treturn message;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tif(mxGetClassID(lhs[0]) != mxUINT64_CLASS){\n"
+            functionWrapper += "\t\t/* the error is raised when the helicsMex call that ran the callback returns, HELICS gets the message unchanged */\n"
+            functionWrapper += "\t\tdeferCallbackError(\"MATLAB:helicsFilterSetCustomCallback:TypeError\",\"return type must be of type uint64.\");\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs[0]);\n"
+            functionWrapper += "\t\treturn message;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tHelicsMessage rv = *(static_cast<HelicsMessage *>(mxGetData(lhs[0])));\n"
+            functionWrapper += "\tmxDestroyArray(lhs[0]);\n"
             functionWrapper += "\treturn rv;\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFilter", "filter", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFilterSetCustomCallback\", filter, argv[1], {mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL)});\n"
+            functionWrapper += "\tuserData->detach = [filter](HelicsError *err){ helicsFilterSetCustomCallback(filter, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(filter, &matlabFilterCustomCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2591,40 +3698,50 @@ class MatlabBindingGenerator(object):
                 raise RuntimeError("the function signature for helicsFederateSetQueryCallback has changed!")
             functionName = functionDict.get("spelling","")
             functionComment = "%\tSet callback for queries executed against a federate.\n\n"
-            functionComment += "%\t@details There are many queries that HELICS understands directly, but it is occasionally useful to a have a federate be able to respond\n%\ttospecific queries with answers specific to a federate.\n\n"
+            functionComment += "%\t@details There are many queries that HELICS understands directly, but it is occasionally useful to a have a federate be able to respond\n%\ttospecific queries with answers specific to a federate.\n"
+            functionComment += "%\tThe callback runs only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),\n"
+            functionComment += "%\tHELICS waits for it for at most the time set with helicsCallbackSetTimeout and then handles the query as if the callback had left the buffer empty.\n\n"
             functionComment += "%\t@param fed The federate object in which to set the callback.\n"
             functionComment += "%\t@param queryAnswer A function handle with the signature const void(const char *query, int querySize, HelicsQueryBuffer buffer).\n"
             functionWrapper = "void matlabFederateQueryCallback(const char* query, int querySize, HelicsQueryBuffer buffer, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[4];\n"
+            functionWrapper += "\tif(answerNativeQuery(static_cast<helicsMexCallback *>(userData)->object, query, querySize, buffer)){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tif(!runCallbackOnMatlabThread([&](){ matlabFederateQueryCallback(query, querySize, buffer, userData); })){\n"
+            functionWrapper += "\t\t\t++static_cast<helicsMexCallback *>(userData)->timeouts;\n"
+            functionWrapper += "\t\t}\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "\tmwSize dims[2] = {1, static_cast<mwSize>(querySize)};\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateCharArray(2, dims);\n"
-            functionWrapper += "\tmxChar *pQuery = static_cast<mxChar *>(mxGetData(rhs[1]));\n"
+            functionWrapper += "\tcallback.rhs[1] = mxCreateCharArray(2, dims);\n"
+            functionWrapper += "\tmxChar *pQuery = static_cast<mxChar *>(mxGetData(callback.rhs[1]));\n"
             functionWrapper += "\tfor(int i=0; i<querySize; ++i){\n"
             functionWrapper += "\t\tpQuery[i] = query[i];\n"
             functionWrapper += "\t}\n"
-            functionWrapper += "\trhs[2] = mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxInt64 *rhs2Ptr = mxGetInt64s(rhs[2]);\n"
-            functionWrapper += "\trhs2Ptr[0] = static_cast<mxInt64>(querySize);\n"
-            functionWrapper += "\trhs[3] = mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxUint64 *rhs3Ptr = mxGetUint64s(rhs[3]);\n"
-            functionWrapper += "\trhs3Ptr[0] = reinterpret_cast<mxUint64>(buffer);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,4,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[3]);\n"
+            functionWrapper += "\tmxGetInt64s(callback.rhs[2])[0] = static_cast<mxInt64>(querySize);\n"
+            functionWrapper += "\tmxGetUint64s(callback.rhs[3])[0] = reinterpret_cast<mxUint64>(buffer);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFilter", "filter", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateSetQueryCallback\", filter, argv[1], {nullptr, mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL), mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL)});\n"
+            functionWrapper += "\tuserData->detach = [filter](HelicsError *err){ helicsFederateSetQueryCallback(filter, &nativeQueryResponseCallback, filter, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(filter, &matlabFederateQueryCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2660,31 +3777,33 @@ class MatlabBindingGenerator(object):
             functionComment += "%\t@param fed The federate object in which to set the callback.\n"
             functionComment += "%\t@param timeUpdate A function handle with the signature void(double newTime, int iterating).\n"
             functionWrapper = "void matlabFederateTimeUpdateCallback(HelicsTime newTime, HelicsBool iterating, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[3];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateDoubleScalar(static_cast<double>(newTime));\n"
-            functionWrapper += "\trhs[2] = mxCreateLogicalMatrix(1, 1);\n"
-            functionWrapper += "\tmxLogical *rhs2Ptr = mxGetLogicals(rhs[2]);\n"
-            functionWrapper += "\trhs2Ptr[0] = false;\n"
-            functionWrapper += "\tif(iterating == HELICS_TRUE){\n"
-            functionWrapper += "\t\trhs2Ptr[0] = true;\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,3,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabFederateTimeUpdateCallback(newTime, iterating, userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetDoubles(callback.rhs[1])[0] = static_cast<double>(newTime);\n"
+            functionWrapper += "\tmxGetLogicals(callback.rhs[2])[0] = (iterating == HELICS_TRUE);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateSetTimeUpdateCallback\", fed, argv[1], {mxCreateDoubleScalar(0.0), mxCreateLogicalScalar(false)});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsFederateSetTimeUpdateCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabFederateTimeUpdateCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2720,30 +3839,33 @@ class MatlabBindingGenerator(object):
             functionComment += "%\t@param fed The federate object in which to set the callback.\n"
             functionComment += "%\t@param stateChange A function handle with the signature void(int newState, int oldState).\n"
             functionWrapper = "void matlabFederateSetStateChangeCallback(HelicsFederateState newState, HelicsFederateState oldState, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[3];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxInt32 *rhs1Ptr = mxGetInt32s(rhs[1]);\n"
-            functionWrapper += "\trhs1Ptr[0] = static_cast<mxInt32>(newState);\n"
-            functionWrapper += "\trhs[2] = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxInt32 *rhs2Ptr = mxGetInt32s(rhs[2]);\n"
-            functionWrapper += "\trhs2Ptr[0] = static_cast<mxInt32>(oldState);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,3,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabFederateSetStateChangeCallback(newState, oldState, userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetInt32s(callback.rhs[1])[0] = static_cast<mxInt32>(newState);\n"
+            functionWrapper += "\tmxGetInt32s(callback.rhs[2])[0] = static_cast<mxInt32>(oldState);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateSetStateChangeCallback\", fed, argv[1], {mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL), mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL)});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsFederateSetStateChangeCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabFederateSetStateChangeCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2780,33 +3902,34 @@ class MatlabBindingGenerator(object):
             functionComment += "%\t@param fed The federate object in which to set the callback.\n"
             functionComment += "%\t@param requestTime A callback with the signature void(double currentTime, double requestTime, bool iterating).\n"
             functionWrapper = "void matlabFederateSetTimeRequestEntryCallback(HelicsTime currentTime, HelicsTime requestTime, HelicsBool iterating, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[4];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateDoubleScalar(currentTime);\n"
-            functionWrapper += "\trhs[2] = mxCreateDoubleScalar(requestTime);\n"
-            functionWrapper += "\trhs[3] = mxCreateLogicalMatrix(1, 1);\n"
-            functionWrapper += "\tmxLogical *rhs3Ptr = mxGetLogicals(rhs[3]);\n"
-            functionWrapper += "\trhs3Ptr[0] = false;\n"
-            functionWrapper += "\tif(iterating == HELICS_TRUE){\n"
-            functionWrapper += "\t\trhs3Ptr[0] = true;\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,4,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[3]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabFederateSetTimeRequestEntryCallback(currentTime, requestTime, iterating, userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetDoubles(callback.rhs[1])[0] = currentTime;\n"
+            functionWrapper += "\tmxGetDoubles(callback.rhs[2])[0] = requestTime;\n"
+            functionWrapper += "\tmxGetLogicals(callback.rhs[3])[0] = (iterating == HELICS_TRUE);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateSetTimeRequestEntryCallback\", fed, argv[1], {mxCreateDoubleScalar(0.0), mxCreateDoubleScalar(0.0), mxCreateLogicalScalar(false)});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsFederateSetTimeRequestEntryCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabFederateSetTimeRequestEntryCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2843,31 +3966,33 @@ class MatlabBindingGenerator(object):
             functionComment += "%\t@param fed The federate object in which to set the callback.\n"
             functionComment += "%\t@param requestTimeReturn A callback with the signature void(double newTime, bool iterating).\n"
             functionWrapper = "void matlabFederateSetTimeRequestReturnCallback(HelicsTime newTime, HelicsBool iterating, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[3];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateDoubleScalar(newTime);\n"
-            functionWrapper += "\trhs[2] = mxCreateLogicalMatrix(1, 1);\n"
-            functionWrapper += "\tmxLogical *rhs2Ptr = mxGetLogicals(rhs[2]);\n"
-            functionWrapper += "\trhs2Ptr[0] = false;\n"
-            functionWrapper += "\tif(iterating == HELICS_TRUE){\n"
-            functionWrapper += "\t\trhs2Ptr[0] = true;\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,3,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabFederateSetTimeRequestReturnCallback(newTime, iterating, userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetDoubles(callback.rhs[1])[0] = static_cast<double>(newTime);\n"
+            functionWrapper += "\tmxGetLogicals(callback.rhs[2])[0] = (iterating == HELICS_TRUE);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateSetTimeRequestReturnCallback\", fed, argv[1], {mxCreateDoubleScalar(0.0), mxCreateLogicalScalar(false)});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsFederateSetTimeRequestReturnCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabFederateSetTimeRequestReturnCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2903,52 +4028,60 @@ class MatlabBindingGenerator(object):
             functionName = functionDict.get("spelling","")
             functionComment = "%\tSet a general callback for a custom Translator.n\n"
             functionComment += "%\t@details Add a pair of custom callbacks for running a translator operation in the C shared library.\n"
+            functionComment += "%\tThe callbacks run only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),\n"
+            functionComment += "%\tHELICS waits for them for at most the time set with helicsCallbackSetTimeout and then leaves the output unchanged.\n"
             functionComment += "%\t@param translator The translator object to set the callbacks for.\n"
             functionComment += "%\t@param toMessageCall A callback with the signature void(HelicsDataBuffer, HelicsMessage).\n"
             functionComment += "%\t@param toValueCall A callback with the signature void(HelicsMessage, HelicsDataBuffer).\n"
             functionWrapper = "void matlabToMessageCallCallback(HelicsDataBuffer value, HelicsMessage message, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[3];\n"
-            functionWrapper += "\trhs[0] = static_cast<mxArray **>(userData)[0];\n"
-            functionWrapper += "\trhs[1] = mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxUint64 *rhs1Ptr = mxGetUint64s(rhs[1]);\n"
-            functionWrapper += "\trhs1Ptr[0] = reinterpret_cast<mxUint64>(value);\n"
-            functionWrapper += "\trhs[2] = mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxUint64 *rhs2Ptr = mxGetUint64s(rhs[1]);\n"
-            functionWrapper += "\trhs2Ptr[0] = reinterpret_cast<mxUint64>(message);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,3,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tif(!runCallbackOnMatlabThread([&](){ matlabToMessageCallCallback(value, message, userData); })){\n"
+            functionWrapper += "\t\t\t++static_cast<helicsMexCallback *>(userData)->timeouts;\n"
+            functionWrapper += "\t\t}\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetUint64s(callback.rhs[1])[0] = reinterpret_cast<mxUint64>(value);\n"
+            functionWrapper += "\tmxGetUint64s(callback.rhs[2])[0] = reinterpret_cast<mxUint64>(message);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += "void matlabToValueCallCallback(HelicsMessage message, HelicsDataBuffer value, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[3];\n"
-            functionWrapper += "\trhs[0] = static_cast<mxArray **>(userData)[1];\n"
-            functionWrapper += "\trhs[1] = mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxUint64 *rhs1Ptr = mxGetUint64s(rhs[1]);\n"
-            functionWrapper += "\trhs1Ptr[0] = reinterpret_cast<mxUint64>(message);\n"
-            functionWrapper += "\trhs[2] = mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxUint64 *rhs2Ptr = mxGetUint64s(rhs[1]);\n"
-            functionWrapper += "\trhs2Ptr[0] = reinterpret_cast<mxUint64>(value);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,3,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tif(!runCallbackOnMatlabThread([&](){ matlabToValueCallCallback(message, value, userData); })){\n"
+            functionWrapper += "\t\t\t++static_cast<helicsMexCallback *>(userData)->next->timeouts;\n"
+            functionWrapper += "\t\t}\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(static_cast<helicsMexCallback *>(userData)->next);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetUint64s(callback.rhs[1])[0] = reinterpret_cast<mxUint64>(message);\n"
+            functionWrapper += "\tmxGetUint64s(callback.rhs[2])[0] = reinterpret_cast<mxUint64>(value);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 3){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 3 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsTranslator", "translator", 0, functionName)
-            functionWrapper += "\tmxArray *callbacks[2];\n"
-            functionWrapper += "\tcallbacks[0] = const_cast<mxArray *>(argv[1]);\n"
-            functionWrapper += "\tcallbacks[1] = const_cast<mxArray *>(argv[2]);\n"
-            functionWrapper += "\tvoid *userData = reinterpret_cast<void *>(callbacks);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsTranslatorSetCustomCallback\", translator, argv[1], {mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL), mxCreateNumericMatrix(1, 1, mxUINT64_CLASS, mxREAL)}, argv[2]);\n"
+            functionWrapper += "\tuserData->detach = [translator](HelicsError *err){ helicsTranslatorSetCustomCallback(translator, nullptr, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(translator, &matlabToMessageCallCallback, &matlabToValueCallCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -2983,12 +4116,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
             functionWrapper += f"\tif(!mxIsComplex(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 1 must be of type complex.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 1 must be of type complex.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += "\tmxComplexDouble *value = mxGetComplexDoubles(argv[1]);\n\n"
             functionWrapper += f"\tint32_t result = {functionName}(data, value->real, value->imag);\n\n"
@@ -3028,12 +4161,12 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
             functionWrapper += f"\tif(!mxIsNumeric(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 1 must be an array of doubles.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 1 must be an array of doubles.\");\n"
             functionWrapper += "\t}\n"
             functionWrapper += "\tint dataSize =  static_cast<int>(mxGetNumberOfElements(argv[1]));\n\n"
             functionWrapper += "\tdouble *value =  static_cast<double *>(mxGetDoubles(argv[1]));\n\n"
@@ -3074,21 +4207,16 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
-            functionWrapper += f"\tif(!mxIsComplex(argv[1])){{\n"
+            functionWrapper += f"\tif(!mxIsDouble(argv[1])){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be of an array of type complex.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"Argument 2 must be an array of type complex or double.\");\n"
             functionWrapper += "\t}\n"
-            functionWrapper += "\tint dataSize =  static_cast<int>(mxGetN(argv[1])*2);\n\n"
-            functionWrapper += "\tdouble *value = static_cast<double *>(malloc(dataSize * sizeof(double)));\n"
-            functionWrapper += "\tmxComplexDouble *vals = mxGetComplexDoubles(argv[1]);\n"
-            functionWrapper += "\tfor(int i=0; i<dataSize/2; ++i){\n"
-            functionWrapper += "\t\tvalue[2*i] = vals[i].real;\n"
-            functionWrapper += "\t\tvalue[2*i + 1] = vals[i].imag;\n"
-            functionWrapper += "\t}\n\n"
-            functionWrapper += f"\tint32_t result = {functionName}(data, static_cast<const double *>(value), dataSize);\n\n"
+            functionWrapper += "\tint dataSize = static_cast<int>(mxGetNumberOfElements(argv[1])*2);\n\n"
+            functionWrapper += "\tconst double *value = getInterleavedComplexData(argv[1]);\n\n"
+            functionWrapper += f"\tint32_t result = {functionName}(data, value, dataSize);\n\n"
             functionWrapper += "\tmxArray *_out = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);\n"
             functionWrapper += "\tmxInt32 *rv = mxGetInt32s(_out);\n"
             functionWrapper += "\trv[0] = static_cast<mxInt32>(result);\n"
@@ -3127,11 +4255,11 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
             functionWrapper += "\tint maxStringLen = helicsDataBufferStringSize(data) + 2;\n\n"
-            functionWrapper += "\tchar *outputString = static_cast<char *>(malloc(maxStringLen));\n\n"
+            functionWrapper += "\tchar *outputString = static_cast<char *>(marshalArena.allocate(maxStringLen));\n\n"
             functionWrapper += "\tint actualLength = 0;\n\n"
             functionWrapper += f"\t{functionName}(data, outputString, maxStringLen, &actualLength);\n\n"
             functionWrapper += "\tmwSize dims[2] = {1, static_cast<mwSize>(actualLength)};\n"
@@ -3144,7 +4272,6 @@ class MatlabBindingGenerator(object):
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("outputString")}\n\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
             functionMainElements += f"\t\t_wrap_{functionName}(resc, resv, argc, argv);\n"
@@ -3176,11 +4303,11 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
             functionWrapper += "\tint maxStringLen = helicsDataBufferStringSize(data) + 2;\n\n"
-            functionWrapper += "\tchar *outputString = static_cast<char *>(malloc(maxStringLen));\n\n"
+            functionWrapper += "\tchar *outputString = static_cast<char *>(marshalArena.allocate(maxStringLen));\n\n"
             functionWrapper += "\tint actualLength = 0;\n\n"
             functionWrapper += f"\t{functionName}(data, outputString, maxStringLen, &actualLength);\n\n"
             functionWrapper += "\tmwSize dims[2] = {1, static_cast<mwSize>(actualLength) - 1};\n"
@@ -3193,7 +4320,6 @@ class MatlabBindingGenerator(object):
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
             functionWrapper += "\t}\n\n"
-            functionWrapper += f'{argCharPostFunctionCall("outputString")}\n\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
             functionMainElements += f"\t\t_wrap_{functionName}(resc, resv, argc, argv);\n"
@@ -3222,7 +4348,7 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
             functionWrapper += "\tdouble values[2];\n\n"
@@ -3257,7 +4383,7 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
             functionWrapper += f"\tHelicsComplex result = {functionName}(data);\n\n"
@@ -3301,19 +4427,14 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
             functionWrapper += "\tint maxLen = helicsDataBufferVectorSize(data);\n\n"
-            functionWrapper += "\tdouble *values = static_cast<double *>(malloc(maxLen * sizeof(double)));\n\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleMatrix(maxLen, 1, mxREAL);\n\n"
             functionWrapper += "\tint actualSize = 0;\n\n"
-            functionWrapper += f"\t{functionName}(data, values, maxLen, &actualSize);\n\n"
-            functionWrapper += "\tmxDouble *result_data = static_cast<mxDouble *>(mxMalloc(actualSize * sizeof(mxDouble)));\n"
-            functionWrapper += "\tfor(int i=0; i<actualSize; ++i){\n"
-            functionWrapper += "\t\tresult_data[i] = static_cast<mxDouble>(values[i]);\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += "\tmxArray *_out = mxCreateDoubleMatrix(actualSize, 1, mxREAL);\n"
-            functionWrapper += "\tint status = mxSetDoubles(_out, &(result_data[0]));\n\n"
+            functionWrapper += f"\t{functionName}(data, mxGetDoubles(_out), maxLen, &actualSize);\n\n"
+            functionWrapper += "\tmxSetM(_out, actualSize);\n\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -3349,20 +4470,14 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
             functionWrapper += "\tint maxLen = helicsDataBufferVectorSize(data);\n\n"
-            functionWrapper += "\tdouble *values = static_cast<double *>(malloc(maxLen * sizeof(double)));\n\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleMatrix(maxLen/2, 1, mxCOMPLEX);\n\n"
             functionWrapper += "\tint actualSize = 0;\n\n"
-            functionWrapper += f"\t{functionName}(data, values, maxLen, &actualSize);\n\n"
-            functionWrapper += "\tmxComplexDouble *result_data = static_cast<mxComplexDouble *>(mxMalloc((actualSize/2)*sizeof(mxComplexDouble)));\n"
-            functionWrapper += "\tfor(int i=0; i<(actualSize/2); ++i){\n"
-            functionWrapper += "\t\tresult_data[i].real = values[2*(i)];\n"
-            functionWrapper += "\t\tresult_data[i].imag = values[2*(i) + 1];\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += "\tmxArray *_out = mxCreateDoubleMatrix(actualSize/2, 1, mxCOMPLEX);\n"
-            functionWrapper += "\tint status = mxSetComplexDoubles(_out, &(result_data[0]));\n\n"
+            functionWrapper += f"\t{functionName}(data, reinterpret_cast<double *>(mxGetComplexDoubles(_out)), 2*(maxLen/2), &actualSize);\n\n"
+            functionWrapper += "\tmxSetM(_out, actualSize/2);\n\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -3401,11 +4516,11 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 1){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 1 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsDataBuffer", "data", 0, functionName)
             functionWrapper += "\tint maxStringLen = helicsInputGetStringSize(data) + 2;\n\n"
-            functionWrapper += "\tchar *outputString = static_cast<char *>(malloc(maxStringLen));\n\n"
+            functionWrapper += "\tchar *outputString = static_cast<char *>(marshalArena.allocate(maxStringLen));\n\n"
             functionWrapper += "\tint actualLength = 0;\n\n"
             functionWrapper += "\tdouble val = 0;\n\n"
             functionWrapper += f"\t{functionName}(data, outputString, maxStringLen, &actualLength, &val);\n\n"
@@ -3423,7 +4538,6 @@ class MatlabBindingGenerator(object):
             functionWrapper += "\t\tmxArray *_out1 = mxCreateDoubleScalar(val);\n"
             functionWrapper += "\t\t*resv++ = _out1;\n"
             functionWrapper += "\t}\n\n" 
-            functionWrapper += f'{argCharPostFunctionCall("outputString")}\n'
             functionWrapper += "}\n\n\n"
             functionMainElements = f"\tcase {cursorIdx}:\n"
             functionMainElements += f"\t\t_wrap_{functionName}(resc, resv, argc, argv);\n"
@@ -3443,9 +4557,11 @@ class MatlabBindingGenerator(object):
             functionWrapper = f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 0){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 0 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 0 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += f"\t{functionName}();\n\n"
+            functionWrapper += "\t/* HELICS frees every broker, core and federate and their messages */\n"
+            functionWrapper += "\treleaseLibraryObjects();\n\n"
             functionWrapper += "\tmxArray *_out = nullptr;\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
@@ -3482,29 +4598,32 @@ class MatlabBindingGenerator(object):
             functionComment += "\t@param fed The federate object in which to set the callback.\n"
             functionComment += "\t@param initializingEntry A function handle with the signature void(HelicsBool iterating).\n"
             functionWrapper = "void matlabFederateInitializingEntryCallback(HelicsBool iterating, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[2];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateLogicalMatrix(1, 1);\n"
-            functionWrapper += "\tmxLogical *rhs1Ptr = mxGetLogicals(rhs[1]);\n"
-            functionWrapper += "\trhs1Ptr[0] = false;\n"
-            functionWrapper += "\tif(iterating == HELICS_TRUE){\n"
-            functionWrapper += "\t\trhs1Ptr[0] = true;\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,2,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabFederateInitializingEntryCallback(iterating, userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetLogicals(callback.rhs[1])[0] = (iterating == HELICS_TRUE);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateInitializingEntryCallback\", fed, argv[1], {mxCreateLogicalScalar(false)});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsFederateInitializingEntryCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabFederateInitializingEntryCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -3540,22 +4659,31 @@ class MatlabBindingGenerator(object):
             functionComment += "\t@param fed The federate object in which to set the callback.\n"
             functionComment += "\t@param executingEntry A function handle with the signature void(void).\n"
             functionWrapper = "void matlabFederateExecutingEntryCallback(void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[1];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,1,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabFederateExecutingEntryCallback(userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateExecutingEntryCallback\", fed, argv[1], {});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsFederateExecutingEntryCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabFederateExecutingEntryCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -3591,22 +4719,31 @@ class MatlabBindingGenerator(object):
             functionComment += "\t@param fed The federate object in which to set the callback.\n"
             functionComment += "\t@param cosimTermination A function handle with the signature void(void).\n"
             functionWrapper = "void matlabFederateCosimulationTerminationCallback(void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[1];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,1,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabFederateCosimulationTerminationCallback(userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateCosimulationTerminationCallback\", fed, argv[1], {});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsFederateCosimulationTerminationCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabFederateCosimulationTerminationCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -3642,28 +4779,34 @@ class MatlabBindingGenerator(object):
             functionComment += "\t@param fed The federate object in which to set the callback.\n"
             functionComment += "\t@param errorHandler A function handle with the signature void(int errorCode, const char* errorString).\n"
             functionWrapper = "void matlabFederateErrorHandlerCallback(int errorCode, const char* errorString, void *userData){\n"
-            functionWrapper += "\tmxArray *lhs;\n"
-            functionWrapper += "\tmxArray *rhs[3];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxInt32 *rhs1Ptr = mxGetInt32s(rhs[1]);\n"
-            functionWrapper += "\trhs1Ptr[0] = static_cast<mxInt32>(errorCode);\n"
-            functionWrapper += "\trhs[2] = mxCreateString(errorString);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(0,&lhs,3,rhs,"feval");\n'
-            functionWrapper += "\tmxDestroyArray(lhs);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tstd::string errorStringCopy(errorString);\n"
+            functionWrapper += "\t\tqueueCallbackEvent([=](){ matlabFederateErrorHandlerCallback(errorCode, errorStringCopy.c_str(), userData); });\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetInt32s(callback.rhs[1])[0] = static_cast<mxInt32>(errorCode);\n"
+            functionWrapper += "\tcallback.rhs[2] = mxCreateString(errorString);\n"
+            functionWrapper += "\tmxArray *lhs = nullptr;\n"
+            functionWrapper += "\tint status = callback.call(0, &lhs);\n"
+            functionWrapper += "\tif(lhs != nullptr){\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs);\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsFederateErrorHandlerCallback\", fed, argv[1], {mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL), nullptr});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsFederateErrorHandlerCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabFederateErrorHandlerCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -3694,35 +4837,49 @@ class MatlabBindingGenerator(object):
             if arg3.get("spelling","") != "err" or arg3.get("pointer_type", "") != "HelicsError_*":
                 raise RuntimeError("the function signature for helicsCallbackFederateNextTimeCallback has changed!")
             functionName = functionDict.get("spelling","")
-            functionComment = "\tSet callback for the next time update=.\n\n"
-            functionComment += "\t@details This callback will be executed to compute the next time update for a callback federate.\n\n"
-            functionComment += "\t@param fed The federate object in which to set the callback.\n"
-            functionComment += "\t@param timeUpdate A function handle with the signature HelicsTime (HelicsTime time).\n"
+            functionComment = "%\tSet callback for the next time update=.\n\n"
+            functionComment += "%\t@details This callback will be executed to compute the next time update for a callback federate.\n"
+            functionComment += "%\tThe callback runs only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),\n"
+            functionComment += "%\tHELICS waits for it for at most the time set with helicsCallbackSetTimeout and then requests the time it passed in.\n\n"
+            functionComment += "%\t@param fed The federate object in which to set the callback.\n"
+            functionComment += "%\t@param timeUpdate A function handle with the signature HelicsTime (HelicsTime time).\n"
             functionWrapper = "HelicsTime matlabCallbackFederateNextTimeCallback(HelicsTime time, void *userData){\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tHelicsTime rv = time;\n"
+            functionWrapper += "\t\tif(!runCallbackOnMatlabThread([&](){ rv = matlabCallbackFederateNextTimeCallback(time, userData); })){\n"
+            functionWrapper += "\t\t\t++static_cast<helicsMexCallback *>(userData)->timeouts;\n"
+            functionWrapper += "\t\t}\n"
+            functionWrapper += "\t\treturn rv;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn time;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetDoubles(callback.rhs[1])[0] = time;\n"
             functionWrapper += "\tmxArray *lhs[1];\n"
-            functionWrapper += "\tmxArray *rhs[2];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateDoubleScalar(time);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(1,lhs,2,rhs,"feval");\n'
-            functionWrapper += f"\tif(!mxIsNumeric(lhs[0])){{\n"
-            functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:TypeError\",\"return type must be of type double.\");\n"
+            functionWrapper += "\tif(callback.call(1, lhs) != 0){\n"
+            functionWrapper += "\t\treturn time;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tif(!mxIsNumeric(lhs[0])){\n"
+            functionWrapper += "\t\tdeferCallbackError(\"MATLAB:helicsCallbackFederateNextTimeCallback:TypeError\",\"return type must be of type double.\");\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs[0]);\n"
+            functionWrapper += "\t\treturn time;\n"
             functionWrapper += "\t}\n"
-            functionWrapper += f"\tHelicsTime rv = (HelicsTime)(mxGetScalar(lhs[0]));\n\n"
+            functionWrapper += "\tHelicsTime rv = (HelicsTime)(mxGetScalar(lhs[0]));\n\n"
             functionWrapper += "\tmxDestroyArray(lhs[0]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
             functionWrapper += "\treturn rv;\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:matlabCallbackFederateNextTimeCallback:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:matlabCallbackFederateNextTimeCallback:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsCallbackFederateNextTimeCallback\", fed, argv[1], {mxCreateDoubleScalar(0.0)});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsCallbackFederateNextTimeCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabCallbackFederateNextTimeCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -3753,50 +4910,61 @@ class MatlabBindingGenerator(object):
             if arg3.get("spelling","") != "err" or arg3.get("pointer_type", "") != "HelicsError_*":
                 raise RuntimeError("the function signature for helicsCallbackFederateNextTimeIterativeCallback has changed!")
             functionName = functionDict.get("spelling","")
-            functionComment = "\tSet callback for the next time update with iteration capability.\n\n"
-            functionComment += "\t@details This callback will be executed to compute the next time update for a callback federate.\n\n"
-            functionComment += "\t@param fed The federate object in which to set the callback.\n"
-            functionComment += "\t@param timeUpdate A function handle with the signature void(HelicsTime time, HelicsIterationResult iterationResult, HelicsIterationRequest* iteration).\n"
+            functionComment = "%\tSet callback for the next time update with iteration capability.\n\n"
+            functionComment += "%\t@details This callback will be executed to compute the next time update for a callback federate.\n"
+            functionComment += "%\tThe callback runs only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),\n"
+            functionComment += "%\tHELICS waits for it for at most the time set with helicsCallbackSetTimeout and then requests the time it passed in without changing the iteration request.\n\n"
+            functionComment += "%\t@param fed The federate object in which to set the callback.\n"
+            functionComment += "%\t@param timeUpdate A function handle with the signature void(HelicsTime time, HelicsIterationResult iterationResult, HelicsIterationRequest* iteration).\n"
             functionWrapper = "HelicsTime matlabCallbackFederateNextTimeIterativeCallback(HelicsTime time, HelicsIterationResult iterationResult, HelicsIterationRequest *iteration, void *userData){\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tHelicsTime rv = time;\n"
+            functionWrapper += "\t\tif(!runCallbackOnMatlabThread([&](){ rv = matlabCallbackFederateNextTimeIterativeCallback(time, iterationResult, iteration, userData); })){\n"
+            functionWrapper += "\t\t\t++static_cast<helicsMexCallback *>(userData)->timeouts;\n"
+            functionWrapper += "\t\t}\n"
+            functionWrapper += "\t\treturn rv;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn time;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxGetDoubles(callback.rhs[1])[0] = time;\n"
+            functionWrapper += "\tmxGetInt32s(callback.rhs[2])[0] = static_cast<mxInt32>(iterationResult);\n"
+            functionWrapper += "\tmxGetInt32s(callback.rhs[3])[0] = static_cast<mxInt32>(*iteration);\n"
             functionWrapper += "\tmxArray *lhs[2];\n"
-            functionWrapper += "\tmxArray *rhs[4];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += "\trhs[1] = mxCreateDoubleScalar(time);\n"
-            functionWrapper += "\trhs[2] = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxInt32 *pRhs2 = mxGetInt32s(rhs[2]);\n"
-            functionWrapper += "\tpRhs2[0] = static_cast<mxInt32>(iterationResult);\n"
-            functionWrapper += "\trhs[3] = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);\n"
-            functionWrapper += "\tmxInt32 *pRhs3 = mxGetInt32s(rhs[3]);\n"
-            functionWrapper += "\tpRhs3[0] = static_cast<mxInt32>(*iteration);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(2,lhs,4,rhs,"feval");\n'
-            functionWrapper += f"\tif(!mxIsNumeric(lhs[0])){{\n"
-            functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:matlabCallbackFederateNextTimeIterativeCallback:TypeError\",\"first type returned must be of type double.\");\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += f"\tHelicsTime rv = (HelicsTime)(mxGetScalar(lhs[0]));\n\n"
-            functionWrapper += f"\tif(mxGetClassID(lhs[1]) != mxINT32_CLASS){{\n"
-            functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:matlabCallbackFederateNextTimeIterativeCallback:TypeError\",\"second type returned must be of type int32.\");\n"
-            functionWrapper += "\t}\n"
-            functionWrapper += f"\tmxInt32 *pIterationRequest = mxGetInt32s(lhs[1]);\n"
-            functionWrapper += f"\t*iteration = static_cast<HelicsIterationRequest>(pIterationRequest[0]);\n\n"
+            functionWrapper += "\tif(callback.call(2, lhs) != 0){\n"
+            functionWrapper += "\t\treturn time;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tif(!mxIsNumeric(lhs[0])){\n"
+            functionWrapper += "\t\tdeferCallbackError(\"MATLAB:matlabCallbackFederateNextTimeIterativeCallback:TypeError\",\"first type returned must be of type double.\");\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs[0]);\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs[1]);\n"
+            functionWrapper += "\t\treturn time;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tHelicsTime rv = (HelicsTime)(mxGetScalar(lhs[0]));\n\n"
+            functionWrapper += "\tif(mxGetClassID(lhs[1]) != mxINT32_CLASS){\n"
+            functionWrapper += "\t\tdeferCallbackError(\"MATLAB:matlabCallbackFederateNextTimeIterativeCallback:TypeError\",\"second type returned must be of type int32.\");\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs[0]);\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs[1]);\n"
+            functionWrapper += "\t\treturn time;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxInt32 *pIterationRequest = mxGetInt32s(lhs[1]);\n"
+            functionWrapper += "\t*iteration = static_cast<HelicsIterationRequest>(pIterationRequest[0]);\n\n"
             functionWrapper += "\tmxDestroyArray(lhs[0]);\n"
             functionWrapper += "\tmxDestroyArray(lhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[1]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[2]);\n"
-            functionWrapper += "\tmxDestroyArray(rhs[3]);\n"
             functionWrapper += "\treturn rv;\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsCallbackFederateNextTimeIterativeCallback\", fed, argv[1], {mxCreateDoubleScalar(0.0), mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL), mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL)});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsCallbackFederateNextTimeIterativeCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabCallbackFederateNextTimeIterativeCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -3827,34 +4995,49 @@ class MatlabBindingGenerator(object):
             if arg3.get("spelling","") != "err" or arg3.get("pointer_type", "") != "HelicsError_*":
                 raise RuntimeError("the function signature for helicsCallbackFederateInitializeCallback has changed!")
             functionName = functionDict.get("spelling","")
-            functionComment = "\tSet callback for initialization.\n\n"
-            functionComment += "\t@details This callback will be executed when computing whether to iterate in initialization mode.\n\n"
-            functionComment += "\t@param fed The federate object in which to set the callback.\n"
-            functionComment += "\t@param initialize A function handle with the signature HelicsIterationRequest(void).\n"
+            functionComment = "%\tSet callback for initialization.\n\n"
+            functionComment += "%\t@details This callback will be executed when computing whether to iterate in initialization mode.\n"
+            functionComment += "%\tThe callback runs only while MATLAB is inside a blocking HELICS call or in helicsMex('__pump',timeout),\n"
+            functionComment += "%\tHELICS waits for it for at most the time set with helicsCallbackSetTimeout and then does not iterate.\n\n"
+            functionComment += "%\t@param fed The federate object in which to set the callback.\n"
+            functionComment += "%\t@param initialize A function handle with the signature HelicsIterationRequest(void).\n"
             functionWrapper = "HelicsIterationRequest matlabCallbackFederateInitializeCallback(void *userData){\n"
+            functionWrapper += "\tif(!onMatlabThread()){\n"
+            functionWrapper += "\t\tHelicsIterationRequest rv = HELICS_ITERATION_REQUEST_NO_ITERATION;\n"
+            functionWrapper += "\t\tif(!runCallbackOnMatlabThread([&](){ rv = matlabCallbackFederateInitializeCallback(userData); })){\n"
+            functionWrapper += "\t\t\t++static_cast<helicsMexCallback *>(userData)->timeouts;\n"
+            functionWrapper += "\t\t}\n"
+            functionWrapper += "\t\treturn rv;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\thelicsMexCallbackCall callback(userData);\n"
+            functionWrapper += "\tif(callback.rhs[0] == nullptr){\n"
+            functionWrapper += "\t\treturn HELICS_ITERATION_REQUEST_NO_ITERATION;\n"
+            functionWrapper += "\t}\n"
             functionWrapper += "\tmxArray *lhs[1];\n"
-            functionWrapper += "\tmxArray *rhs[1];\n"
-            functionWrapper += "\trhs[0] = reinterpret_cast<mxArray *>(userData);\n"
-            functionWrapper += '\tint status = mexCallMATLAB(1,lhs,1,rhs,"feval");\n'
-            functionWrapper += f"\tif(mxGetClassID(lhs[0]) != mxINT32_CLASS){{\n"
-            functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:matlabCallbackFederateInitializeCallback:TypeError\",\"return type must be of type int32.\");\n"
+            functionWrapper += "\tif(callback.call(1, lhs) != 0){\n"
+            functionWrapper += "\t\treturn HELICS_ITERATION_REQUEST_NO_ITERATION;\n"
             functionWrapper += "\t}\n"
-            functionWrapper += f"\tmxInt32 *pIterationRequest = mxGetInt32s(lhs[0]);\n"
-            functionWrapper += f"\tHelicsIterationRequest rv = static_cast<HelicsIterationRequest>(pIterationRequest[0]);\n\n"
+            functionWrapper += "\tif(mxGetClassID(lhs[0]) != mxINT32_CLASS){\n"
+            functionWrapper += "\t\tdeferCallbackError(\"MATLAB:matlabCallbackFederateInitializeCallback:TypeError\",\"return type must be of type int32.\");\n"
+            functionWrapper += "\t\tmxDestroyArray(lhs[0]);\n"
+            functionWrapper += "\t\treturn HELICS_ITERATION_REQUEST_NO_ITERATION;\n"
+            functionWrapper += "\t}\n"
+            functionWrapper += "\tmxInt32 *pIterationRequest = mxGetInt32s(lhs[0]);\n"
+            functionWrapper += "\tHelicsIterationRequest rv = static_cast<HelicsIterationRequest>(pIterationRequest[0]);\n\n"
             functionWrapper += "\tmxDestroyArray(lhs[0]);\n"
             functionWrapper += "\treturn rv;\n"
             functionWrapper += "}\n\n"
             functionWrapper += f"void _wrap_{functionName}(int resc, mxArray *resv[], int argc, const mxArray *argv[])" + "{\n"
             functionWrapper += f"\tif(argc != 2){{\n"
             functionWrapper += "\t\tmexUnlock();\n"
-            functionWrapper += f"\t\tmexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
+            functionWrapper += f"\t\thelicsMexErrMsgIdAndTxt(\"MATLAB:{functionName}:rhs\",\"This function requires 2 arguments.\");\n"
             functionWrapper += "\t}\n\n"
             functionWrapper += initializeArgHelicsClass("HelicsFederate", "fed", 0, functionName)
-            functionWrapper += "\tvoid *userData = mxGetData(argv[1]);\n"
+            functionWrapper += "\thelicsMexCallback *userData = registerMatlabCallback(\"helicsCallbackFederateInitializeCallback\", fed, argv[1], {});\n"
+            functionWrapper += "\tuserData->detach = [fed](HelicsError *err){ helicsCallbackFederateInitializeCallback(fed, nullptr, nullptr, err); };\n"
             functionWrapper += initializeArgHelicsErrorPtr("err")
             functionWrapper += f"\t{functionName}(fed, &matlabCallbackFederateInitializeCallback, userData, &err);\n\n"
-            functionWrapper += "\tmxArray *_out = nullptr;\n"
+            functionWrapper += "\tmxArray *_out = mxCreateDoubleScalar(static_cast<double>(userData->id));\n"
             functionWrapper += "\tif(_out){\n"
             functionWrapper += "\t\t--resc;\n"
             functionWrapper += "\t\t*resv++ = _out;\n"
@@ -3867,38 +5050,395 @@ class MatlabBindingGenerator(object):
             return functionComment, functionWrapper, functionMainElements
         
         
-        def createMexMain() -> str:
-            mexMainStr = "void mexFunction(int resc, mxArray *resv[], int argc, const mxArray *argv[]) {\n"
-            mexMainStr += "\tif(--argc < 0 || !mxIsChar(*argv)){\n"
+        def createExtraMexFunctions(firstIdx: int):
+            """
+                Add the hand written mex functions in extra_mex_codes, these are numbered after the generated wrappers
+            """
+            extraMexCodeFiles = [
+                "helicsMexBatch.cpp",
+                "helicsBulkPublish.cpp",
+                "helicsBulkInput.cpp",
+                "helicsRawBytes.cpp",
+                "helicsPublicationPublish.cpp",
+                "helicsInputGetValue.cpp",
+                "helicsCallbackQueue.cpp",
+                "helicsFilterOperators.cpp",
+                "helicsTranslatorKernels.cpp",
+                "helicsLoggingBuffer.cpp",
+                "helicsCallbackRegistry.cpp",
+                "helicsQueryResponses.cpp",
+                "helicsFederateGroups.cpp",
+                "helicsPlayer.cpp",
+                "helicsMessageDrain.cpp",
+                "helicsEndpointSendMany.cpp",
+                "helicsMessagePool.cpp",
+                "helicsMessageStruct.cpp",
+                "helicsObjectRegistry.cpp"
+            ]
+            # (name passed to helicsMex, wrapper function name, help text for the +helics .m file or None if no .m file is needed)
+            extraMexFunctions = [
+                ("__batch", "helicsMexBatch", None),
+                ("helicsFederatePublishDoubles", "helicsFederatePublishDoubles",
+                    "% Publish a double value on each publication in a set with a single call.\n%\n"
+                    "% @param fed The federate the publications belong to.\n"
+                    "% @param pubs A uint64 array of publication objects.\n"
+                    "% @param values A double array with one value per publication.\n\n"),
+                ("helicsFederatePublishComplexes", "helicsFederatePublishComplexes",
+                    "% Publish a complex value on each publication in a set with a single call.\n%\n"
+                    "% @param fed The federate the publications belong to.\n"
+                    "% @param pubs A uint64 array of publication objects.\n"
+                    "% @param values A complex array with one value per publication.\n\n"),
+                ("helicsFederatePublishVectors", "helicsFederatePublishVectors",
+                    "% Publish a vector on each publication in a set with a single call.\n%\n"
+                    "% @param fed The federate the publications belong to.\n"
+                    "% @param pubs A uint64 array of publication objects.\n"
+                    "% @param values A cell array with one double vector per publication or a\n"
+                    "%        double matrix with one column per publication.\n\n"),
+                ("helicsFederatePublishComplexVectors", "helicsFederatePublishComplexVectors",
+                    "% Publish a complex vector on each publication in a set with a single call.\n%\n"
+                    "% @param fed The federate the publications belong to.\n"
+                    "% @param pubs A uint64 array of publication objects.\n"
+                    "% @param values A cell array with one complex vector per publication or a\n"
+                    "%        complex or real matrix with one column per publication, real values\n"
+                    "%        are published with zero imaginary parts.\n\n"),
+                ("helicsFederateGetInputDoubles", "helicsFederateGetInputDoubles",
+                    "% Get the double values and update status of a set of inputs with a single call.\n%\n"
+                    "% @param fed The federate the inputs belong to.\n"
+                    "% @param inputs A uint64 array of input objects.\n"
+                    "% @param clearUpdates Optional, if true the update flag of each input is cleared\n"
+                    "%        after it is read as with helicsInputClearUpdate (default false).\n%\n"
+                    "% @return A column vector of the input values.\n"
+                    "% @return A logical column vector, true for each input that was updated before the call.\n\n"),
+                ("helicsInputGetRawBytes", "helicsInputGetRawBytes",
+                    "% Get the raw data for the latest value of a subscription as bytes.\n%\n"
+                    "% @param ipt The input to get the data for.\n%\n"
+                    "% @return A uint8 row vector with the uninterpreted bytes of the value.\n\n"),
+                ("helicsMessageGetRawBytes", "helicsMessageGetRawBytes",
+                    "% Get the raw data for a message object as bytes.\n%\n"
+                    "% @param message A message object to get the data for.\n%\n"
+                    "% @return A uint8 row vector with the message payload.\n\n"),
+                ("helicsPublicationPublish", "helicsPublicationPublish",
+                    "% Publish a value through HELICS, the publish function is picked from the type of the value.\n%\n"
+                    "% @param pub The publication to publish the value on.\n"
+                    "% @param value The value to publish.\n"
+                    "%        char: a single character as a char, otherwise a string.\n"
+                    "%        double/single: a scalar as a double, otherwise a vector; complex values as a complex or complex vector.\n"
+                    "%        logical: a scalar as a boolean, otherwise a vector.\n"
+                    "%        int8: a scalar as a char, otherwise a vector.\n"
+                    "%        other integer types: a scalar as an integer, otherwise a vector.\n"
+                    "%        cell: {name, value} as a named point, a cell array of strings as a JSON array string.\n\n"),
+                ("helicsInputGetValue", "helicsInputGetValue",
+                    "% Get the value of an input converted to the data type of the publication it is connected to.\n%\n"
+                    "% @details The publication data type is looked up once per input and cached.\n"
+                    "%        double and time values are returned as a double, integers as an int64, booleans as a logical,\n"
+                    "%        complex values as a complex double, vectors as double or complex column vectors, named points\n"
+                    "%        as a struct with name and value fields, raw data as a uint8 array and anything else as a string.\n%\n"
+                    "% @param ipt The input to get the value for.\n%\n"
+                    "% @return The value of the input.\n"
+                    "% @return The HelicsDataTypes value used to convert the value.\n\n"),
+                ("__pump", "helicsMexPump", None),
+                ("helicsFilterAddNativeOperator", "helicsFilterAddNativeOperator",
+                    "% Add a built in message operator to a filter, the operator runs inside HELICS without calling MATLAB.\n%\n"
+                    "% @details Operators added to the same filter are applied in order, each call to this function\n"
+                    "%        installs the filter custom callback so it should be used on custom filters. The 'duplicate'\n"
+                    "%        operator adds delivery endpoints and raises an error unless the filter was registered as a\n"
+                    "%        cloning filter.\n"
+                    "%        Operators should be added before the federate enters executing mode.\n%\n"
+                    "% @param filt The filter to add the operator to.\n"
+                    "% @param name The name of the operator.\n"
+                    "%        'delay': delay messages by 'delay' seconds, or by 'delays' for the matching entry of 'destinations'.\n"
+                    "%        'bernoulliLoss': drop each message with 'probability'.\n"
+                    "%        'gilbertElliottLoss': burst loss with state change probabilities 'goodToBad' and 'badToGood'\n"
+                    "%            and loss probabilities 'lossGood' (default 0) and 'lossBad' (default 1).\n"
+                    "%        'tokenBucket': drop messages exceeding 'rate' bytes per second with a bucket of 'burst' bytes.\n"
+                    "%        'truncate': cut payloads to 'maxBytes' bytes.\n"
+                    "%        'reroute': replace destinations matching the regular expression 'pattern' with 'destination'.\n"
+                    "%        'duplicate': deliver copies to the endpoint or cell array of endpoints in 'destinations'.\n"
+                    "% @param params Optional, a struct with the operator parameters, the loss operators also accept a 'seed'.\n\n"),
+                ("helicsFilterClearNativeOperators", "helicsFilterClearNativeOperators",
+                    "% Remove the built in message operators from a filter, messages then pass through unchanged.\n%\n"
+                    "% @param filt The filter to clear.\n\n"),
+                ("helicsTranslatorSetNativeKernel", "helicsTranslatorSetNativeKernel",
+                    "% Set a built in conversion kernel for a translator, the conversion runs inside HELICS without calling MATLAB.\n%\n"
+                    "% @details This replaces a callback set with helicsTranslatorSetCustomCallback, which remains available\n"
+                    "%        for conversions that need MATLAB code.\n%\n"
+                    "% @param trans The translator to set the kernel for.\n"
+                    "% @param name The name of the kernel.\n"
+                    "%        'doubleJson': a double value and a {\"key\":value} JSON message, parameter 'key' (default 'value').\n"
+                    "%        'vectorCsv': a vector value and a separated list, parameter 'separator' (default ',').\n"
+                    "%        'namedPointKeyValue': a named point and a name=value message, parameter 'separator' (default '=').\n"
+                    "%        'binaryPack': a vector value and a fixed binary layout, parameter 'layout' with one of the\n"
+                    "%            field types d, f, q, Q, i, I, h, H, b, B per element and an optional < or > byte order prefix.\n"
+                    "% @param params Optional, a struct with the kernel parameters.\n\n"),
+                ("helicsFederateSetLoggingBuffer", "helicsFederateSetLoggingBuffer",
+                    "% Collect the log messages of a federate in a buffer instead of calling MATLAB for each message.\n%\n"
+                    "% @details Messages are filtered when they are logged, kept messages are read with\n"
+                    "%        helicsLoggingBufferDrain or delivered in batches to a callback. The callback only runs while\n"
+                    "%        MATLAB waits in a blocking HELICS call or in helicsMex('__pump',timeout).\n"
+                    "%        Calling this again changes the options of the existing buffer, freeing the object removes it.\n%\n"
+                    "% @param fed The federate to buffer the log messages of.\n"
+                    "% @param options Optional, a struct with the buffer options.\n"
+                    "%        'level': the highest log level kept, higher levels are discarded (default all).\n"
+                    "%        'pattern': a regular expression, only messages matching it are kept.\n"
+                    "%        'capacity': the number of messages kept, the oldest are dropped when full (default 10000).\n"
+                    "%        'callback': a function handle called as callback(entries, dropped) with the buffered messages.\n"
+                    "%        'batchSize': deliver to the callback once this many messages are buffered (default 100).\n"
+                    "%        'interval': also deliver to the callback every interval milliseconds (default 0, disabled).\n\n"),
+                ("helicsCoreSetLoggingBuffer", "helicsCoreSetLoggingBuffer",
+                    "% Collect the log messages of a core in a buffer instead of calling MATLAB for each message.\n%\n"
+                    "% @details Messages are filtered when they are logged, kept messages are read with\n"
+                    "%        helicsLoggingBufferDrain or delivered in batches to a callback. The callback only runs while\n"
+                    "%        MATLAB waits in a blocking HELICS call or in helicsMex('__pump',timeout).\n"
+                    "%        Calling this again changes the options of the existing buffer, freeing the object removes it.\n%\n"
+                    "% @param core The core to buffer the log messages of.\n"
+                    "% @param options Optional, a struct with the buffer options.\n"
+                    "%        'level': the highest log level kept, higher levels are discarded (default all).\n"
+                    "%        'pattern': a regular expression, only messages matching it are kept.\n"
+                    "%        'capacity': the number of messages kept, the oldest are dropped when full (default 10000).\n"
+                    "%        'callback': a function handle called as callback(entries, dropped) with the buffered messages.\n"
+                    "%        'batchSize': deliver to the callback once this many messages are buffered (default 100).\n"
+                    "%        'interval': also deliver to the callback every interval milliseconds (default 0, disabled).\n\n"),
+                ("helicsBrokerSetLoggingBuffer", "helicsBrokerSetLoggingBuffer",
+                    "% Collect the log messages of a broker in a buffer instead of calling MATLAB for each message.\n%\n"
+                    "% @details Messages are filtered when they are logged, kept messages are read with\n"
+                    "%        helicsLoggingBufferDrain or delivered in batches to a callback. The callback only runs while\n"
+                    "%        MATLAB waits in a blocking HELICS call or in helicsMex('__pump',timeout).\n"
+                    "%        Calling this again changes the options of the existing buffer, freeing the object removes it.\n%\n"
+                    "% @param broker The broker to buffer the log messages of.\n"
+                    "% @param options Optional, a struct with the buffer options.\n"
+                    "%        'level': the highest log level kept, higher levels are discarded (default all).\n"
+                    "%        'pattern': a regular expression, only messages matching it are kept.\n"
+                    "%        'capacity': the number of messages kept, the oldest are dropped when full (default 10000).\n"
+                    "%        'callback': a function handle called as callback(entries, dropped) with the buffered messages.\n"
+                    "%        'batchSize': deliver to the callback once this many messages are buffered (default 100).\n"
+                    "%        'interval': also deliver to the callback every interval milliseconds (default 0, disabled).\n\n"),
+                ("helicsLoggingBufferDrain", "helicsLoggingBufferDrain",
+                    "% Remove the oldest messages from the logging buffer of a federate, core or broker.\n%\n"
+                    "% @param obj The federate, core or broker the buffer was set for.\n"
+                    "% @param maxCount Optional, the largest number of messages to return (default all).\n%\n"
+                    "% @return A struct array with level, identifier and message fields, use struct2table for a table.\n"
+                    "% @return The number of messages dropped because the buffer was full since the last drain.\n\n"),
+                ("helicsCallbackRemove", "helicsCallbackRemove",
+                    "% Remove a callback set from MATLAB, the callback is cleared in HELICS and its function handle released.\n%\n"
+                    "% @details Calls that were already queued for the MATLAB thread are skipped. The object the callback\n"
+                    "%        was set on must not have been freed.\n%\n"
+                    "% @param id The callback id returned by the function that set the callback.\n\n"),
+                ("helicsCallbackGetStatistics", "helicsCallbackGetStatistics",
+                    "% Get the callbacks set from MATLAB with the number of calls and the time spent in MATLAB.\n%\n"
+                    "% @param id Optional, the callback id returned by the function that set the callback (default all).\n%\n"
+                    "% @return A struct array with id, setter, callback, calls, totalSeconds, maxSeconds, meanSeconds and timeouts\n"
+                    "%        fields, timeouts counts the calls skipped because MATLAB did not run them within the time set with\n"
+                    "%        helicsCallbackSetTimeout. A translator callback has one entry per function handle.\n\n"),
+                ("helicsFederateSetQueryResponse", "helicsFederateSetQueryResponse",
+                    "% Set the answer to a query of a federate, the query is answered without calling MATLAB.\n%\n"
+                    "% @details Queries without an answer go to the callback set with helicsFederateSetQueryCallback.\n"
+                    "%        Calling this again for the same query replaces the answer, which is a cheap way to keep\n"
+                    "%        a live value current.\n%\n"
+                    "% @param fed The federate to answer the query for.\n"
+                    "% @param query The query string to answer.\n"
+                    "% @param answer A string returned as it is, a double array returned as a JSON number or array\n"
+                    "%        formatted when queried, or empty to remove the answer.\n\n"),
+                ("helicsFederateClearQueryResponses", "helicsFederateClearQueryResponses",
+                    "% Remove every query answer set with helicsFederateSetQueryResponse for a federate.\n%\n"
+                    "% @param fed The federate to clear the answers of.\n\n"),
+                ("helicsFederatesRequestTimeAll", "helicsFederatesRequestTimeAll",
+                    "% Request a time for several federates and wait until all of them have been granted a time.\n%\n"
+                    "% @details The requests are made at the same time so federates in the same process do not block\n"
+                    "%        each other, queued callbacks run while waiting.\n%\n"
+                    "% @param feds A uint64 array of federates.\n"
+                    "% @param times The requested time, a scalar for all federates or one time per federate.\n%\n"
+                    "% @return The granted times in an array of the same size as feds.\n\n"),
+                ("helicsFederatesWaitAny", "helicsFederatesWaitAny",
+                    "% Wait until at least one of several federates has completed a time request made with\n"
+                    "% helicsFederateRequestTimeAsync and complete the requests that are done.\n%\n"
+                    "% @details Queued callbacks run while waiting. Federates without an outstanding time request are\n"
+                    "%        skipped and it is an error if none has one. A request that is not done yet keeps completing in\n"
+                    "%        the background and is returned by a later call or by helicsFederateRequestTimeComplete.\n%\n"
+                    "% @param feds A uint64 array of federates with outstanding time requests.\n"
+                    "% @param timeout Optional, the longest time to wait in milliseconds (default wait forever).\n%\n"
+                    "% @return A column vector with the indices into feds of the completed requests, empty on timeout.\n"
+                    "% @return A column vector with the granted time of each completed request.\n\n"),
+                ("helicsFederateRunPlayer", "helicsFederateRunPlayer",
+                    "% Replay a table of values on a set of publications from a background thread.\n%\n"
+                    "% @details For each row the player requests the time and then publishes the row on the publications.\n"
+                    "%        The federate must not be used from MATLAB until the player has finished, callbacks it raises\n"
+                    "%        run while MATLAB waits in helicsPlayerWait or helicsMex('__pump').\n%\n"
+                    "% @param fed The federate to step, it must be in executing mode.\n"
+                    "% @param pubs A uint64 array of publications.\n"
+                    "% @param times The time of each step.\n"
+                    "% @param values A double matrix with one row per time and one column per publication.\n%\n"
+                    "% @return The id of the player.\n\n"),
+                ("helicsPlayerStop", "helicsPlayerStop",
+                    "% Ask a player to stop before its next time request.\n%\n"
+                    "% @param id The id returned by helicsFederateRunPlayer.\n\n"),
+                ("helicsPlayerGetStatus", "helicsPlayerGetStatus",
+                    "% Get the progress of a player.\n%\n"
+                    "% @param id The id returned by helicsFederateRunPlayer.\n%\n"
+                    "% @return A struct with running, step (the number of steps published), time (the last granted time)\n"
+                    "%        and error fields.\n\n"),
+                ("helicsPlayerWait", "helicsPlayerWait",
+                    "% Wait for a player to finish, running queued callbacks while waiting.\n%\n"
+                    "% @details A finished player is released and its id is no longer valid after this call.\n%\n"
+                    "% @param id The id returned by helicsFederateRunPlayer.\n"
+                    "% @param timeout Optional, the longest time to wait in milliseconds (default wait until finished).\n%\n"
+                    "% @return The status of the player as returned by helicsPlayerGetStatus.\n\n"),
+                ("helicsEndpointGetAllMessages", "helicsEndpointGetAllMessages",
+                    "% Get all the pending messages for an endpoint in a single call.\n%\n"
+                    "% @details The messages are freed once they are copied, there is no HelicsMessage to free afterwards.\n%\n"
+                    "% @param endpoint The endpoint to receive from.\n"
+                    "% @param maxCount Optional, the most messages to return (default all pending messages).\n"
+                    "% @param columnar Optional, true to return a single struct whose fields hold one entry per message (default false).\n%\n"
+                    "% @return A struct array with the fields of helicsMessageToStruct, source, destination, originalSource,\n"
+                    "%         originalDestination, time, messageID, flags and data.\n\n"),
+                ("helicsFederateGetAllMessages", "helicsFederateGetAllMessages",
+                    "% Get all the pending messages for all the endpoints of a federate in a single call.\n%\n"
+                    "% @details The messages are freed once they are copied, there is no HelicsMessage to free afterwards.\n%\n"
+                    "% @param fed The federate to receive from.\n"
+                    "% @param maxCount Optional, the most messages to return (default all pending messages).\n"
+                    "% @param columnar Optional, true to return a single struct whose fields hold one entry per message (default false).\n%\n"
+                    "% @return A struct array with the fields of helicsMessageToStruct, source, destination, originalSource,\n"
+                    "%         originalDestination, time, messageID, flags and data.\n\n"),
+                ("helicsEndpointSendMany", "helicsEndpointSendMany",
+                    "% Send several messages from an endpoint in a single call.\n%\n"
+                    "% @param endpoint The endpoint to send from.\n"
+                    "% @param payloads A cell array with one string or uint8 array per message.\n"
+                    "% @param destinations Optional, a cell array with one destination per message or a single destination for all of\n"
+                    "%        them, empty uses the default destination of the endpoint.\n"
+                    "% @param times Optional, one time per message or a single time for all of them, empty sends at the current time.\n\n"),
+                ("helicsFederateSetMessagePool", "helicsFederateSetMessagePool",
+                    "% Set the size of the pool of reusable messages for a federate and fill it.\n%\n"
+                    "% @param fed The federate that creates the messages.\n"
+                    "% @param capacity The number of messages kept in the pool, 0 frees the pooled messages.\n"
+                    "% @param reserveSize Optional, the number of bytes reserved in each pooled message (default 0).\n\n"),
+                ("helicsFederateGetPooledMessage", "helicsFederateGetPooledMessage",
+                    "% Get a cleared message from the pool of a federate, a new message is created if the pool is empty.\n%\n"
+                    "% @details Return the message with helicsEndpointSendPooledMessage or helicsMessageReleaseToPool.\n%\n"
+                    "% @param fed The federate that owns the pool.\n%\n"
+                    "% @return A HelicsMessage.\n\n"),
+                ("helicsEndpointSendPooledMessage", "helicsEndpointSendPooledMessage",
+                    "% Send a message and return it to the pool it came from.\n%\n"
+                    "% @details The message must not be used after this call, messages that are not from a pool are only sent.\n%\n"
+                    "% @param endpoint The endpoint to send from.\n"
+                    "% @param message A message from helicsFederateGetPooledMessage.\n\n"),
+                ("helicsMessageReleaseToPool", "helicsMessageReleaseToPool",
+                    "% Clear a message and return it to the pool it came from without sending it.\n%\n"
+                    "% @param message A message from helicsFederateGetPooledMessage.\n\n"),
+                ("helicsFederateGetMessagePoolStatistics", "helicsFederateGetMessagePoolStatistics",
+                    "% Get the usage counters of the message pool of a federate.\n%\n"
+                    "% @param fed The federate that owns the pool.\n%\n"
+                    "% @return A struct with the fields capacity, reserveSize, available, outstanding, hits, misses and recycled.\n\n"),
+                ("helicsMessageToStruct", "helicsMessageToStruct",
+                    "% Get every field and the payload of one or more messages in a single call.\n%\n"
+                    "% @param message A HelicsMessage or an array of them.\n%\n"
+                    "% @return A struct array of the same size with the fields source, destination, originalSource, originalDestination,\n"
+                    "%         time, messageID, flags and data. flags is a uint16 whose bit k is flag k of the message and data is a\n"
+                    "%         uint8 row vector.\n\n"),
+                ("helicsMessageFromStruct", "helicsMessageFromStruct",
+                    "% Create messages with their fields and payload set from a struct array in a single call.\n%\n"
+                    "% @param fed The federate that creates the messages.\n"
+                    "% @param s A struct array with any of the fields returned by helicsMessageToStruct, missing or empty fields keep\n"
+                    "%        their default value.\n%\n"
+                    "% @return An array of HelicsMessage of the same size as s.\n\n"),
+                ("__objects", "helicsMexObjects", None),
+                ("helicsCallbackSetTimeout", "helicsCallbackSetTimeout",
+                    "% Set how long HELICS waits for MATLAB to run a callback that returns a value to HELICS.\n%\n"
+                    "% @details Filter, translator, query and callback federate callbacks block the HELICS thread that raises them\n"
+                    "%        until MATLAB runs them, which it only does while it waits inside a blocking HELICS call or in\n"
+                    "%        helicsMex('__pump',timeout). A call MATLAB has not started in time is skipped, a filter then passes\n"
+                    "%        the message through unchanged, a translator leaves its output unchanged, a query is handled as\n"
+                    "%        if its buffer was left empty and a callback federate keeps the time it was given.\n%\n"
+                    "% @param timeout The timeout in milliseconds, negative or Inf waits forever (default 10000).\n\n")
+            ]
+            extraMexStr = ""
+            for codeFile in extraMexCodeFiles:
+                with open(os.path.join(filePath, "extra_mex_codes", codeFile), "r") as extraMexFile:
+                    extraMexStr += extraMexFile.read()
+            extraMapTuples = []
+            extraWrapperTuples = []
+            for i, (mexName, wrapperName, functionComment) in enumerate(extraMexFunctions):
+                cursorIdx = firstIdx + i
+                extraMapTuples.append((mexName, cursorIdx))
+                extraWrapperTuples.append((wrapperName, cursorIdx))
+                if functionComment != None:
+                    with open(os.path.join(self.__rootDir, f"matlabBindings/+helics/{mexName}.m"), "w") as functionMFile:
+                        functionMFile.write(f"function varargout = {mexName}(varargin)\n")
+                        functionMFile.write(functionComment)
+                        functionMFile.write("\t[varargout{1:nargout}] = helicsMex(" + f"int32({cursorIdx}), varargin" + "{:});\n")
+                        functionMFile.write("end\n")
+            return extraMexStr, extraMapTuples, extraWrapperTuples
+        
+        
+        def createMexMain(helicsWrapperTuples) -> str:
+            wrapperIds = {idx: name for name, idx in helicsWrapperTuples}
+            tableOffset = min(wrapperIds.keys())
+            mexMainStr = f"static const int wrapperFunctionTableOffset = {tableOffset};\n\n"
+            mexMainStr += "/* direct-index jump table, wrapperFunctionTable[functionId - wrapperFunctionTableOffset] */\n"
+            mexMainStr += "static const wrapperFunction wrapperFunctionTable[] = {\n"
+            for idx in range(tableOffset, max(wrapperIds.keys()) + 1):
+                if idx in wrapperIds:
+                    mexMainStr += f"\t_wrap_{wrapperIds[idx]},\n"
+                else:
+                    mexMainStr += "\tnullptr,\n"
+            mexMainStr += "};\n\n"
+            mexMainStr += "static const int wrapperFunctionTableSize = static_cast<int>(sizeof(wrapperFunctionTable) / sizeof(wrapperFunction));\n\n"
+            mexMainStr += "static wrapperFunction getWrapperFunction(int functionId) {\n"
+            mexMainStr += "\tif(functionId < wrapperFunctionTableOffset || functionId >= wrapperFunctionTableOffset + wrapperFunctionTableSize){\n"
+            mexMainStr += "\t\treturn nullptr;\n"
+            mexMainStr += "\t}\n"
+            mexMainStr += "\treturn wrapperFunctionTable[functionId - wrapperFunctionTableOffset];\n"
+            mexMainStr += "}\n\n"
+            mexMainStr += "/* the generated .m files pass an int32 function id, the name lookup is kept for direct calls by name */\n"
+            mexMainStr += "static int getWrapperFunctionId(const mxArray *functionArg) {\n"
+            mexMainStr += "\tif(mxGetClassID(functionArg) == mxINT32_CLASS && mxGetNumberOfElements(functionArg) == 1){\n"
+            mexMainStr += "\t\treturn static_cast<int>(*mxGetInt32s(functionArg));\n"
+            mexMainStr += "\t}\n"
+            mexMainStr += "\tif(mxIsChar(functionArg)){\n"
+            mexMainStr += "\t\tchar functionName[128];\n"
+            mexMainStr += "\t\tif(mxGetString(functionArg, functionName, sizeof(functionName)) == 0){\n"
+            mexMainStr += "\t\t\tauto functionEntry = wrapperFunctionMap.find(functionName);\n"
+            mexMainStr += "\t\t\tif(functionEntry != wrapperFunctionMap.end()){\n"
+            mexMainStr += "\t\t\t\treturn functionEntry->second;\n"
+            mexMainStr += "\t\t\t}\n"
+            mexMainStr += "\t\t}\n"
+            mexMainStr += "\t}\n"
+            mexMainStr += "\treturn -1;\n"
+            mexMainStr += "}\n\n"
+            mexMainStr += "void mexFunction(int resc, mxArray *resv[], int argc, const mxArray *argv[]) {\n"
+            mexMainStr += "\tif(--argc < 0 || (!mxIsChar(*argv) && mxGetClassID(*argv) != mxINT32_CLASS)){\n"
             mexMainStr += "\t\tmexErrMsgTxt(\"This mex file should only be called from inside the .m files. First input should be the function ID.\");\n"
             mexMainStr += "\t}\n"
-            mexMainStr += "\tint functionId;\n"
-            mexMainStr += "\ttry {\n"
-            mexMainStr += "\t\tfunctionId = wrapperFunctionMap.at(std::string(mxArrayToString(*argv++)));\n"
-            mexMainStr += "\t} catch (const std::out_of_range& e) {\n"
-            mexMainStr += "\t\tmexErrMsgTxt(\"unrecognized function id.\");\n"
+            mexMainStr += "\twrapperFunction wrapper = getWrapperFunction(getWrapperFunctionId(*argv++));\n"
+            mexMainStr += "\tif(wrapper == nullptr){\n"
+            mexMainStr += "\t\thelicsMexErrMsgIdAndTxt(\"helics:mexFunction\",\"An unknown function id was encountered. Call the mex function with a valid function id.\");\n"
             mexMainStr += "\t}\n"
-            mexMainStr += "\tint flag=0;\n"
             mexMainStr += "\t/* Prevent unloading this file until MATLAB exits */\n"
             mexMainStr += "\tif(!mexFunctionCalled) {\n"
             mexMainStr += "\t\tmexFunctionCalled = 1;\n"
             mexMainStr += "\t\tmexLock();\n"
+            mexMainStr += "\t\tmexAtExit(helicsMexAtExit);\n"
+            mexMainStr += "\t\t/* fixes the MATLAB thread that queued callbacks are run on */\n"
+            mexMainStr += "\t\tonMatlabThread();\n"
+            mexMainStr += "\t}\n"
+            mexMainStr += "\t/* calls made from inside a callback keep the arena memory of the call that triggered the callback */\n"
+            mexMainStr += "\tmexCallDepthGuard depthGuard;\n"
+            mexMainStr += "\tif(mexCallDepth == 1){\n"
+            mexMainStr += "\t\tmarshalArena.reset();\n"
+            mexMainStr += "\t}\n"
+            mexMainStr += "\t/* an error deferred at this depth or deeper was left by a call that has already returned */\n"
+            mexMainStr += "\tif(deferredCallbackErrorDepth >= mexCallDepth){\n"
+            mexMainStr += "\t\tdeferredCallbackErrorDepth = 0;\n"
             mexMainStr += "\t}\n"
-            mexMainStr += "\tswitch (functionId) {\n"
+            mexMainStr += "\twrapper(resc, resv, argc, argv);\n"
+            mexMainStr += "\traiseDeferredCallbackError();\n"
+            mexMainStr += "}\n\n"
             return mexMainStr
         
         
-        def closeBoilerPlate() -> str:
-            boilerPlateStr = "\tdefault:\n"
-            boilerPlateStr += "\t\tmexErrMsgIdAndTxt(\"helics:mexFunction\",\"An unknown function id was encountered. Call the mex function with a valid function id.\");\n"
-            boilerPlateStr += "\t}\n}\n\n"
-            return boilerPlateStr 
         filePath = os.path.dirname(__file__)   
         if not os.path.exists(os.path.join(self.__rootDir, "matlabBindings/+helics")):
             os.makedirs(os.path.join(self.__rootDir, "matlabBindings/+helics"))
             try:
                 shutil.copy2(os.path.join(filePath, "extra_m_codes/helicsInputSetDefault.m"), os.path.join(self.__rootDir, "matlabBindings/+helics"))
-                shutil.copy2(os.path.join(filePath, "extra_m_codes/helicsPublicationPublish.m"), os.path.join(self.__rootDir, "matlabBindings/+helics"))
             except:
                 matlabBindingGeneratorLogger.warning("couldn't copy extra_m_codes.")
         else:
@@ -3909,37 +5449,38 @@ class MatlabBindingGenerator(object):
                 matlabBindingGeneratorLogger.warning("couldn't delete the old bindings files.")
             try:
                 shutil.copy2(os.path.join(filePath, "extra_m_codes/helicsInputSetDefault.m"), os.path.join(self.__rootDir, "matlabBindings/+helics"))
-                shutil.copy2(os.path.join(filePath, "extra_m_codes/helicsPublicationPublish.m"), os.path.join(self.__rootDir, "matlabBindings/+helics"))
             except:
                 matlabBindingGeneratorLogger.warning("couldn't copy extra_m_codes.")
         helicsMexStr = ""
         helicsMexWrapperFunctions = []
-        helicsMexMainFunctionElements = []
         helicsMapTuples = []
+        helicsWrapperTuples = []
         for cu in self.__helicsParser.parsedInfo.keys():
             if self.__helicsParser.parsedInfo[cu]["kind"] == "ENUM_DECL":
                 createEnum(self.__helicsParser.parsedInfo[cu])
             if self.__helicsParser.parsedInfo[cu]["kind"] == "MACRO_DEFINITION":
                 macroMexWrapperFunctionStr, macroMexMainFunctionElementStr, macroMapTuple= createMacro(self.__helicsParser.parsedInfo[cu],int(cu))
                 helicsMexWrapperFunctions.append(macroMexWrapperFunctionStr)
-                helicsMexMainFunctionElements.append(macroMexMainFunctionElementStr)
                 if macroMapTuple != None:
                     helicsMapTuples.append(macroMapTuple)
+                    helicsWrapperTuples.append(macroMapTuple)
             if self.__helicsParser.parsedInfo[cu]["kind"] == "VAR_DECL":
                 createVar(self.__helicsParser.parsedInfo[cu],int(cu))
             if self.__helicsParser.parsedInfo[cu]["kind"] == "FUNCTION_DECL":
                 functionMexWrapperFunctionStr, functionMexMainFunctionElementStr, functionMapTuple= createFunction(self.__helicsParser.parsedInfo[cu],int(cu))
                 helicsMexWrapperFunctions.append(functionMexWrapperFunctionStr)
-                helicsMexMainFunctionElements.append(functionMexMainFunctionElementStr)
                 if functionMapTuple != None:
                     helicsMapTuples.append(functionMapTuple)
+                    if functionMexMainFunctionElementStr != "":
+                        helicsWrapperTuples.append(functionMapTuple)
+        extraMexStr, extraMapTuples, extraWrapperTuples = createExtraMexFunctions(max(idx for _, idx in helicsMapTuples) + 1)
+        helicsMapTuples += extraMapTuples
+        helicsWrapperTuples += extraWrapperTuples
         helicsMexStr += createBoilerPlate(self.__helicsParser.headerFiles, helicsMapTuples)
         for wrapperStr in helicsMexWrapperFunctions:
             helicsMexStr += wrapperStr
-        helicsMexStr += createMexMain()
-        for element in helicsMexMainFunctionElements:
-            helicsMexStr += element
-        helicsMexStr += closeBoilerPlate()
+        helicsMexStr += extraMexStr
+        helicsMexStr += createMexMain(helicsWrapperTuples)
         with open(os.path.join(self.__rootDir, "helicsMex.cpp"), "w") as helicsMexFile:
             helicsMexFile.write(helicsMexStr)
         matlabBindingGeneratorLogger.info("MATLAB HELICS API successfully created!")
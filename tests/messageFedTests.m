@@ -179,3 +179,324 @@ catch e
     forceCloseStruct(feds);
 end
 end
+
+function testEndpointSendRawBytes(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+try
+epid1 = helicsFederateRegisterEndpoint(feds.mFed, 'ep1', '');
+epid2 = helicsFederateRegisterGlobalEndpoint(feds.mFed, 'ep2', '');
+helicsFederateEnterExecutingMode(feds.mFed);
+
+% embedded zeros and bytes above 127 must survive the round trip
+data = uint8([0 1 2 255 0 128 10 13 0]);
+helicsEndpointSendBytesTo(epid1,data,'ep2');
+helicsFederateRequestTime(feds.mFed,1.0);
+
+message = helicsEndpointGetMessage(epid2);
+testCase.verifyEqual(helicsMessageGetRawBytes(message),data);
+testCase.verifyEqual(helicsMessageGetBytesPointer(message,true),data);
+testCase.verifyClass(helicsMessageGetBytesPointer(message),'uint64');
+testCase.verifyEqual(double(helicsMessageGetBytes(message)),double(data));
+
+helicsMessageSetData(message,uint8([7 0 7]));
+helicsMessageAppendData(message,uint8(0));
+testCase.verifyEqual(helicsMessageGetRawBytes(message),uint8([7 0 7 0]));
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testTranslatorNativeKernel(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+feds.broker=helicsCreateBroker('zmq','mainbroker','-f1');
+fedInfo=helicsCreateFederateInfo();
+helicsFederateInfoSetCoreTypeFromString(fedInfo,'zmq');
+helicsFederateInfoSetCoreInitString(fedInfo,'--broker=mainbroker --federates=1');
+helicsFederateInfoSetTimeProperty(fedInfo,HelicsProperties.HELICS_PROPERTY_TIME_DELTA, 0.01);
+feds.mFed=helicsCreateCombinationFederate('fed1',fedInfo);
+helicsFederateInfoFree(fedInfo);
+testCase.verifyThat(helicsFederateIsValid(feds.mFed)==HELICS_TRUE,IsTrue);
+try
+trans = helicsFederateRegisterGlobalTranslator(feds.mFed, HelicsTranslatorTypes.HELICS_TRANSLATOR_TYPE_CUSTOM, 'csv');
+helicsTranslatorSetNativeKernel(trans, 'vectorCsv', struct('separator',';'));
+ept = helicsFederateRegisterGlobalEndpoint(feds.mFed, 'ept', '');
+pub = helicsFederateRegisterGlobalPublication(feds.mFed, 'pub', HelicsDataTypes.HELICS_DATA_TYPE_VECTOR, '');
+sub = helicsFederateRegisterSubscription(feds.mFed, 'csv', '');
+helicsTranslatorAddPublicationTarget(trans, 'pub');
+helicsTranslatorAddDestinationEndpoint(trans, 'ept');
+helicsFederateEnterExecutingMode(feds.mFed);
+
+% message to value
+helicsEndpointSendBytesTo(ept, '1.5;2;-3', 'csv');
+helicsFederateRequestTime(feds.mFed, 1.0);
+testCase.verifyEqual(helicsInputGetVector(sub), [1.5;2;-3]);
+
+% value to message
+helicsPublicationPublishVector(pub, [4 5.25]);
+helicsFederateRequestTime(feds.mFed, 2.0);
+testCase.verifyEqual(helicsEndpointHasMessage(ept), HELICS_TRUE);
+testCase.verifyEqual(helicsMessageGetString(helicsEndpointGetMessage(ept)), '4;5.25');
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testEndpointGetAllMessages(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+try
+epid1 = helicsFederateRegisterEndpoint(feds.mFed, 'ep1', '');
+epid2 = helicsFederateRegisterGlobalEndpoint(feds.mFed, 'ep2', '');
+helicsFederateEnterExecutingMode(feds.mFed);
+
+helicsEndpointSendBytesTo(epid1,'first','ep2');
+helicsEndpointSendBytesTo(epid1,uint8([0 255 0]),'ep2');
+helicsEndpointSendBytesTo(epid1,['third ' char(233) char(8364) char([55357 56832])],'ep2');
+helicsEndpointSendBytesTo(epid2,'back','fed1/ep1');
+helicsFederateRequestTime(feds.mFed,1.0);
+
+% bounded drain leaves the remaining messages queued
+messages = helicsEndpointGetAllMessages(epid2,2);
+testCase.verifyEqual(numel(messages),2);
+testCase.verifyEqual(messages(1).data,uint8('first'));
+testCase.verifyEqual(messages(2).data,uint8([0 255 0]));
+testCase.verifyEqual(messages(1).originalSource,'fed1/ep1');
+testCase.verifyEqual(messages(1).time,1.0);
+testCase.verifyEqual(double(helicsEndpointPendingMessageCount(epid2)),1);
+
+messages = helicsFederateGetAllMessages(feds.mFed,[],true);
+testCase.verifyEqual(numel(messages.data),2);
+testCase.verifyEqual(sort(messages.destination),{'ep2';'fed1/ep1'});
+% chars are sent as UTF-8, including a surrogate pair
+third = messages.data{strcmp(messages.destination,'ep2')};
+testCase.verifyEqual(third,[uint8('third ') uint8([195 169 226 130 172 240 159 152 128])]);
+testCase.verifyEqual(helicsFederateHasMessage(feds.mFed),HELICS_FALSE);
+
+messages = helicsEndpointGetAllMessages(epid2);
+testCase.verifyEmpty(messages);
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testEndpointSendMany(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+try
+epid1 = helicsFederateRegisterEndpoint(feds.mFed, 'ep1', '');
+epid2 = helicsFederateRegisterGlobalEndpoint(feds.mFed, 'ep2', '');
+epid3 = helicsFederateRegisterGlobalEndpoint(feds.mFed, 'ep3', '');
+helicsEndpointSetDefaultDestination(epid1, 'ep3');
+helicsFederateEnterExecutingMode(feds.mFed);
+
+helicsEndpointSendMany(epid1, {'one', uint8([0 1 2]), ''}, {'ep2','ep2','ep3'}, [1.0;2.0;1.0]);
+helicsEndpointSendMany(epid1, {'default'});
+helicsFederateRequestTime(feds.mFed, 3.0);
+
+messages = helicsEndpointGetAllMessages(epid2);
+testCase.verifyEqual(numel(messages),2);
+testCase.verifyEqual(messages(1).data,uint8('one'));
+testCase.verifyEqual(messages(2).data,uint8([0 1 2]));
+testCase.verifyEqual([messages.time],[1.0 2.0]);
+messages = helicsEndpointGetAllMessages(epid3);
+testCase.verifyEqual(numel(messages),2);
+testCase.verifyEqual(sort(cellfun(@char,{messages.data},'UniformOutput',false)),{'','default'});
+
+testCase.verifyError(@() helicsEndpointSendMany(epid1, {'a','b'}, {'ep2'}),'MATLAB:helicsEndpointSendMany:TypeError');
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testMessagePool(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+try
+epid1 = helicsFederateRegisterEndpoint(feds.mFed, 'ep1', '');
+epid2 = helicsFederateRegisterGlobalEndpoint(feds.mFed, 'ep2', '');
+helicsFederateEnterExecutingMode(feds.mFed);
+helicsFederateSetMessagePool(feds.mFed, 2, 256);
+stats = helicsFederateGetMessagePoolStatistics(feds.mFed);
+testCase.verifyEqual(stats.available,2);
+
+for ii=1:3
+    message = helicsFederateGetPooledMessage(feds.mFed);
+    helicsMessageSetDestination(message, 'ep2');
+    helicsMessageSetString(message, sprintf('packet%d',ii));
+    helicsEndpointSendPooledMessage(epid1, message);
+end
+message = helicsFederateGetPooledMessage(feds.mFed);
+helicsMessageSetString(message, 'unused');
+helicsMessageReleaseToPool(message);
+% a recycled message comes back cleared
+message = helicsFederateGetPooledMessage(feds.mFed);
+testCase.verifyEqual(double(helicsMessageGetByteCount(message)),0);
+helicsMessageReleaseToPool(message);
+
+stats = helicsFederateGetMessagePoolStatistics(feds.mFed);
+testCase.verifyEqual(stats.hits,5);
+testCase.verifyEqual(stats.misses,0);
+testCase.verifyEqual(stats.recycled,5);
+testCase.verifyEqual(stats.outstanding,0);
+
+helicsFederateRequestTime(feds.mFed,1.0);
+messages = helicsEndpointGetAllMessages(epid2);
+testCase.verifyEqual({messages.data},{uint8('packet1'),uint8('packet2'),uint8('packet3')});
+
+% a pooled message that is freed is no longer outstanding
+message = helicsFederateGetPooledMessage(feds.mFed);
+helicsMessageFree(message);
+stats = helicsFederateGetMessagePoolStatistics(feds.mFed);
+testCase.verifyEqual(stats.outstanding,0);
+% clearing the messages of the federate frees the pool with them
+helicsFederateClearMessages(feds.mFed);
+stats = helicsFederateGetMessagePoolStatistics(feds.mFed);
+testCase.verifyEqual([stats.capacity stats.available stats.outstanding],[0 0 0]);
+message = helicsFederateGetPooledMessage(feds.mFed);
+helicsMessageSetString(message, 'fresh');
+testCase.verifyEqual(helicsMessageGetString(message),'fresh');
+helicsMessageReleaseToPool(message);
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testMessageStructConversion(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+try
+epid1 = helicsFederateRegisterEndpoint(feds.mFed, 'ep1', '');
+epid2 = helicsFederateRegisterGlobalEndpoint(feds.mFed, 'ep2', '');
+helicsFederateEnterExecutingMode(feds.mFed);
+
+s = struct('destination',{'ep2','ep2'},'time',{1.0,2.0},'messageID',{7,8},'flags',{uint16(8),uint16(0)},'data',{uint8([0 1 2]),'text'});
+messages = helicsMessageFromStruct(feds.mFed, s);
+testCase.verifyEqual(size(messages),size(s));
+testCase.verifyEqual(helicsMessageGetFlagOption(messages(1),3),HELICS_TRUE);
+
+fields = helicsMessageToStruct(messages);
+testCase.verifyEqual({fields.destination},{'ep2','ep2'});
+testCase.verifyEqual([fields.messageID],[7 8]);
+testCase.verifyEqual([fields.flags],uint16([8 0]));
+testCase.verifyEqual(fields(2).data,uint8('text'));
+
+helicsEndpointSendMessage(epid1, messages(1));
+helicsMessageFree(messages(1));
+helicsMessageFree(messages(2));
+helicsFederateRequestTime(feds.mFed, 1.0);
+received = helicsMessageToStruct(helicsEndpointGetMessage(epid2));
+testCase.verifyEqual(received.data,uint8([0 1 2]));
+testCase.verifyEqual(received.time,1.0);
+
+testCase.verifyError(@() helicsMessageFromStruct(feds.mFed, struct('time','now')),'MATLAB:helicsMessageFromStruct:TypeError');
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testObjectRegistry(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+try
+baseline = helicsMex('__objects');
+testCase.verifyGreaterThanOrEqual(baseline.federates,1);
+message = helicsFederateCreateMessage(feds.mFed);
+query = helicsCreateQuery('root', 'federates');
+counts = helicsMex('__objects');
+testCase.verifyEqual(counts.messages,baseline.messages+1);
+testCase.verifyEqual(counts.queries,baseline.queries+1);
+helicsMessageFree(message);
+helicsQueryFree(query);
+counts = helicsMex('__objects');
+testCase.verifyEqual(counts.messages,baseline.messages);
+testCase.verifyEqual(counts.queries,baseline.queries);
+
+% messages created for a federate are forgotten when the federate clears them
+messages = helicsMessageFromStruct(feds.mFed, struct('data',{'a','b'}));
+counts = helicsMex('__objects');
+testCase.verifyEqual(counts.messages,baseline.messages+numel(messages));
+helicsFederateClearMessages(feds.mFed);
+counts = helicsMex('__objects');
+testCase.verifyEqual(counts.messages,baseline.messages);
+
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+counts = helicsMex('__objects');
+testCase.verifyEqual([counts.federates counts.cores counts.brokers],[0 0 0]);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testUnloadWithCallbacks(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+try
+filt = helicsFederateRegisterFilter(feds.mFed, HelicsFilterTypes.HELICS_FILTER_TYPE_CUSTOM, 'filter1');
+helicsFilterSetCustomCallback(filt, @(message) message);
+helicsFederateSetStateChangeCallback(feds.mFed, @(newState,oldState) []);
+helicsFederateSetQueryCallback(feds.mFed, @(query,querySize,buffer) helicsQueryBufferFill(buffer, 'answer'));
+helicsFederateEnterExecutingMode(feds.mFed);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+    return;
+end
+% unloading destroys the federate and broker with the callbacks still set and must not call MATLAB
+munlock('helicsMex');
+clear('helicsMex');
+counts = helicsMex('__objects');
+testCase.verifyEqual([counts.federates counts.cores counts.brokers],[0 0 0]);
+helicsCloseLibrary();
+end
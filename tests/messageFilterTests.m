@@ -184,6 +184,169 @@ res=helicsEndpointHasMessage(p2);
 testCase.verifyEqual(res,HELICS_TRUE);
 
 
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testNativeFilterOperators(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFeds(2);
+testCase.verifyThat(success,IsTrue);
+try
+mFed=feds.mFed{1};
+fFed=feds.mFed{2};
+
+p1=helicsFederateRegisterGlobalEndpoint(mFed, 'port1', '');
+p2=helicsFederateRegisterGlobalEndpoint(mFed, 'port2', '');
+p3=helicsFederateRegisterGlobalEndpoint(mFed, 'port3', '');
+
+f1=helicsFederateRegisterFilter(fFed,HelicsFilterTypes.HELICS_FILTER_TYPE_CUSTOM,'filter1');
+helicsFilterAddSourceTarget(f1,'port1');
+helicsFilterAddNativeOperator(f1,'delay',struct('delay',1.0,'destinations',{{'port3'}},'delays',2.5));
+helicsFilterAddNativeOperator(f1,'truncate',struct('maxBytes',5));
+helicsFilterAddNativeOperator(f1,'reroute',struct('pattern','^port2$','destination','port3'));
+% only a cloning filter delivers copies
+testCase.verifyError(@() helicsFilterAddNativeOperator(f1,'duplicate',struct('destinations','port2')),'MATLAB:helicsFilterAddNativeOperator:TypeError');
+f2=helicsFederateRegisterCloningFilter(fFed,'filter2');
+helicsFilterAddNativeOperator(f2,'duplicate',struct('destinations',{{'port2'}}));
+
+helicsFederateEnterExecutingModeAsync(mFed);
+helicsFederateEnterExecutingMode(fFed);
+helicsFederateEnterExecutingModeComplete(mFed);
+
+% the delay is picked before the reroute so the port2 delay of 1.0 applies
+helicsEndpointSendBytesTo(p1,'hello world','port2');
+
+granted_time=helicsFederateRequestTime(mFed,3.0);
+testCase.verifyEqual(granted_time,1.0);
+testCase.verifyEqual(helicsEndpointHasMessage(p2),HELICS_FALSE);
+testCase.verifyEqual(helicsEndpointHasMessage(p3),HELICS_TRUE);
+m2=helicsEndpointGetMessage(p3);
+testCase.verifyEqual(helicsMessageGetString(m2),'hello');
+
+% operators can be swapped out and take the filter back from a MATLAB callback, a certain loss drops everything
+helicsFilterSetCustomCallback(f1,@markMessage);
+helicsFilterClearNativeOperators(f1);
+helicsFilterAddNativeOperator(f1,'bernoulliLoss',struct('probability',1.0,'seed',1));
+helicsEndpointSendBytesTo(p1,'lost','port2');
+granted_time=helicsFederateRequestTime(mFed,4.0);
+testCase.verifyEqual(granted_time,4.0);
+testCase.verifyEqual(helicsFederateHasMessage(mFed),HELICS_FALSE);
+
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testCustomFilterTimeout(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFeds(2);
+testCase.verifyThat(success,IsTrue);
+restoreTimeout=onCleanup(@() helicsCallbackSetTimeout(10000));
+try
+mFed=feds.mFed{1};
+fFed=feds.mFed{2};
+
+p1=helicsFederateRegisterGlobalEndpoint(mFed, 'port1', '');
+p2=helicsFederateRegisterGlobalEndpoint(mFed, 'port2', '');
+
+f1=helicsFederateRegisterFilter(fFed,HelicsFilterTypes.HELICS_FILTER_TYPE_CUSTOM,'filter1');
+helicsFilterAddSourceTarget(f1,'port1');
+id=helicsFilterSetCustomCallback(f1,@markMessage);
+
+helicsFederateEnterExecutingModeAsync(mFed);
+helicsFederateEnterExecutingMode(fFed);
+helicsFederateEnterExecutingModeComplete(mFed);
+
+% without any time to wait HELICS skips the callback and passes the message through unchanged
+helicsCallbackSetTimeout(0);
+helicsEndpointSendBytesTo(p1,'hello world','port2');
+helicsFederateRequestTime(mFed,1.0);
+testCase.verifyEqual(helicsEndpointHasMessage(p2),HELICS_TRUE);
+m1=helicsEndpointGetMessage(p2);
+testCase.verifyEqual(helicsMessageGetString(m1),'hello world');
+stats=helicsCallbackGetStatistics(id);
+testCase.verifyGreaterThanOrEqual(stats.timeouts,1);
+testCase.verifyEqual(stats.calls,0);
+
+% waiting forever runs the callback while MATLAB waits for the time request
+helicsCallbackSetTimeout(Inf);
+helicsEndpointSendBytesTo(p1,'hello again','port2');
+helicsFederateRequestTime(mFed,2.0);
+testCase.verifyEqual(helicsEndpointHasMessage(p2),HELICS_TRUE);
+m2=helicsEndpointGetMessage(p2);
+testCase.verifyEqual(helicsMessageGetString(m2),'changed');
+testCase.verifyError(@() helicsCallbackSetTimeout('x'),'MATLAB:helicsCallbackSetTimeout:TypeError');
+
+success=closeStruct(feds);
+testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+   disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function message=markMessage(message)
+helics.helicsMessageSetString(message,'changed');
+end
+
+function testFederateGroupTimeRequests(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFeds(2);
+testCase.verifyThat(success,IsTrue);
+try
+fedArray=[feds.mFed{1},feds.mFed{2}];
+
+helicsFederateEnterExecutingModeAsync(fedArray(1));
+helicsFederateEnterExecutingMode(fedArray(2));
+helicsFederateEnterExecutingModeComplete(fedArray(1));
+
+% both requests block in HELICS at the same time and are returned together
+granted=helicsFederatesRequestTimeAll(fedArray,[1.0,2.0]);
+testCase.verifyEqual(granted,[1.0,2.0]);
+granted=helicsFederatesRequestTimeAll(fedArray,3.0);
+testCase.verifyEqual(granted,[3.0,3.0]);
+
+helicsFederateRequestTimeAsync(fedArray(1),4.0);
+helicsFederateRequestTimeAsync(fedArray(2),5.0);
+done=[];
+times=[];
+while (numel(done)<2)
+    [indices,granted]=helicsFederatesWaitAny(fedArray(setdiff(1:2,done)),5000);
+    testCase.verifyNotEmpty(indices);
+    remaining=setdiff(1:2,done);
+    done=[done,remaining(indices')];
+    times=[times,granted'];
+end
+[done,order]=sort(done);
+testCase.verifyEqual(done,[1,2]);
+testCase.verifyEqual(times(order),[4.0,5.0]);
+
+% a request that is not done when the wait times out is returned by helicsFederateRequestTimeComplete
+helicsFederateRequestTimeAsync(fedArray(1),6.0);
+indices=helicsFederatesWaitAny(fedArray(1),0);
+if isempty(indices)
+    testCase.verifyEqual(helicsFederateRequestTimeComplete(fedArray(1)),6.0);
+end
+% waiting with no outstanding request is an error instead of waiting forever
+testCase.verifyError(@() helicsFederatesWaitAny(fedArray),'helics:invalid_function_call');
+
 success=closeStruct(feds);
 testCase.verifyThat(success,IsTrue);
 catch e
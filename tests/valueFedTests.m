@@ -89,6 +89,14 @@ ver=helicsGetVersion();
 verifyThat(testCase,length(ver),IsGreaterThan(10),'version length is not valid');
 end
 
+function testFunctionNameDispatch(testCase)
+import helics.*
+% calls by function name must still resolve to the same wrapper as the int32 ids
+testCase.verifyEqual(helicsMex('helicsGetVersion'),helicsGetVersion());
+testCase.verifyError(@()helicsMex('helicsNotAFunction'),'helics:mexFunction');
+testCase.verifyError(@()helicsMex(int32(-1)),'helics:mexFunction');
+end
+
 function testEnterExecution(testCase)
 import matlab.unittest.constraints.IsTrue;
 [feds,success]=generateFed();
@@ -661,3 +669,704 @@ catch e
     forceCloseStruct(feds);
 end
 end
+
+function testComplexVector(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    testValue = [1+2i;-3.5+0.25i;0-7i;4];
+
+    pubid = helicsFederateRegisterGlobalPublication(feds.vFed, 'pub1', HelicsDataTypes.HELICS_DATA_TYPE_COMPLEX_VECTOR, '');
+    subid = helicsFederateRegisterSubscription(feds.vFed, 'pub1', '');
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    helicsPublicationPublishComplexVector(pubid, testValue);
+    helicsFederateRequestTime(feds.vFed, 1.0);
+
+    value = helicsInputGetComplexVector(subid);
+    testCase.verifyEqual(value,testValue);
+    value = helicsInputGetVector(subid);
+    testCase.verifyEqual(numel(value),2*numel(testValue));
+
+    % real input is published with zero imaginary parts
+    helicsPublicationPublishComplexVector(pubid, [1.5 -2 3]);
+    helicsFederateRequestTime(feds.vFed, 2.0);
+    value = helicsInputGetComplexVector(subid);
+    testCase.verifyEqual(value,complex([1.5;-2;3]));
+
+    helicsPublicationPublish(pubid, [5-1i 6+1i]);
+    helicsFederateRequestTime(feds.vFed, 3.0);
+    value = helicsInputGetComplexVector(subid);
+    testCase.verifyEqual(value,[5-1i;6+1i]);
+
+    helicsPublicationPublishComplexVector(pubid, complex(zeros(0,1)));
+    helicsFederateRequestTime(feds.vFed, 4.0);
+    value = helicsInputGetComplexVector(subid);
+    testCase.verifyTrue(isempty(value));
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testBatch(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    pubid = helicsFederateRegisterGlobalPublication(feds.vFed, 'pub1', HelicsDataTypes.HELICS_DATA_TYPE_DOUBLE, '');
+    subid = helicsFederateRegisterSubscription(feds.vFed, 'pub1', '');
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    results = helicsMex('__batch', {{'helicsPublicationPublishDouble', pubid, 4.5}});
+    testCase.verifyEqual(size(results),[1,1]);
+    grantedtime = helicsFederateRequestTime(feds.vFed, 1.0);
+    testCase.verifyEqual(grantedtime,0.01);
+
+    % a failing call in the middle must not stop the rest of the batch
+    [results,status] = helicsMex('__batch', {{'helicsInputIsUpdated', subid}, {'helicsInputGetDouble'}, {'helicsInputGetDouble', subid}, {'helicsNotAFunction'}});
+    testCase.verifyEqual(results{3},4.5);
+    testCase.verifyEqual(status(1).identifier,'');
+    testCase.verifyEqual(status(2).identifier,'MATLAB:helicsInputGetDouble:rhs');
+    testCase.verifyEqual(status(3).identifier,'');
+    testCase.verifyEqual(status(4).identifier,'helics:mexFunction');
+
+    % multiple outputs from a single call come back as a cell array
+    results = helicsMex('__batch', {{'helicsFederateRequestTimeIterative', feds.vFed, 2.0, HelicsIterationRequest.HELICS_ITERATION_REQUEST_NO_ITERATION}}, 2);
+    testCase.verifyEqual(results{1}{1},0.02);
+    testCase.verifyEqual(results{1}{2},HelicsIterationResult.HELICS_ITERATION_RESULT_NEXT_STEP);
+
+    % output counts are checked before any call is made
+    testCase.verifyError(@()helicsMex('__batch', {{'helicsPublicationPublishDouble', pubid, 5.5}}, 0),'helics:mexFunction');
+    testCase.verifyError(@()helicsMex('__batch', {{'helicsPublicationPublishDouble', pubid, 5.5}, {'helicsInputGetDouble', subid}}, [1 -1]),'helics:mexFunction');
+    testCase.verifyError(@()helicsMex('__batch', {{'helicsPublicationPublishDouble', pubid, 5.5}}, 1.5),'helics:mexFunction');
+
+    % an error in a call made from a callback that runs during a batch is raised in the callback
+    recordCallbackValues('reset');
+    helicsFederateSetTimeUpdateCallback(feds.vFed, @(newTime,iterating) recordCallbackValues(callbackErrorCaught()));
+    [~,status] = helicsMex('__batch', {{'helicsFederateRequestTime', feds.vFed, 3.0}});
+    helicsMex('__pump');
+    testCase.verifyEqual(status(1).identifier,'');
+    testCase.verifyEqual(unique(recordCallbackValues()),1);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testLongStrings(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    pubid = helicsFederateRegisterGlobalPublication(feds.vFed, 'pub1', HelicsDataTypes.HELICS_DATA_TYPE_STRING, '');
+    subid = helicsFederateRegisterSubscription(feds.vFed, 'pub1', '');
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    % a single string larger than the first 64 KB block of the argument arena
+    longValue = repmat('0123456789abcdef', 1, 8192);
+    helicsPublicationPublishString(pubid, longValue);
+    helicsFederateRequestTime(feds.vFed, 1.0);
+    testCase.verifyEqual(helicsInputGetString(subid), longValue);
+
+    % two strings in one call that do not fit in one block together
+    tagName = repmat('n', 1, 40000);
+    tagValue = repmat('v', 1, 40000);
+    helicsFederateSetTag(feds.vFed, tagName, tagValue);
+    testCase.verifyEqual(helicsFederateGetTag(feds.vFed, tagName), tagValue);
+    helicsFederateSetTag(feds.vFed, 'short', 'value');
+    testCase.verifyEqual(helicsFederateGetTag(feds.vFed, 'short'), 'value');
+
+    % the strings of every call in a batch stay valid until the batch returns
+    [~,status] = helicsMex('__batch', {{'helicsFederateSetTag', feds.vFed, tagName, longValue}, {'helicsPublicationPublishString', pubid, fliplr(longValue)}, {'helicsFederateSetTag', feds.vFed, 'batch', tagValue}});
+    testCase.verifyEqual({status.identifier},{'','',''});
+    testCase.verifyEqual(helicsFederateGetTag(feds.vFed, tagName), longValue);
+    testCase.verifyEqual(helicsFederateGetTag(feds.vFed, 'batch'), tagValue);
+    helicsFederateRequestTime(feds.vFed, 2.0);
+    testCase.verifyEqual(helicsInputGetString(subid), fliplr(longValue));
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testBulkPublish(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    pubs = [helicsFederateRegisterGlobalPublication(feds.vFed, 'pub1', HelicsDataTypes.HELICS_DATA_TYPE_DOUBLE, ''),...
+        helicsFederateRegisterGlobalPublication(feds.vFed, 'pub2', HelicsDataTypes.HELICS_DATA_TYPE_DOUBLE, '')];
+    vpubs = [helicsFederateRegisterGlobalPublication(feds.vFed, 'vpub1', HelicsDataTypes.HELICS_DATA_TYPE_VECTOR, ''),...
+        helicsFederateRegisterGlobalPublication(feds.vFed, 'vpub2', HelicsDataTypes.HELICS_DATA_TYPE_VECTOR, '')];
+    subs = [helicsFederateRegisterSubscription(feds.vFed, 'pub1', ''),...
+        helicsFederateRegisterSubscription(feds.vFed, 'pub2', '')];
+    vsubs = [helicsFederateRegisterSubscription(feds.vFed, 'vpub1', ''),...
+        helicsFederateRegisterSubscription(feds.vFed, 'vpub2', '')];
+    cpubs = [helicsFederateRegisterGlobalPublication(feds.vFed, 'cpub1', HelicsDataTypes.HELICS_DATA_TYPE_COMPLEX_VECTOR, ''),...
+        helicsFederateRegisterGlobalPublication(feds.vFed, 'cpub2', HelicsDataTypes.HELICS_DATA_TYPE_COMPLEX_VECTOR, '')];
+    csubs = [helicsFederateRegisterSubscription(feds.vFed, 'cpub1', ''),...
+        helicsFederateRegisterSubscription(feds.vFed, 'cpub2', '')];
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    helicsFederatePublishDoubles(feds.vFed, pubs, [1.5, -2.25]);
+    helicsFederatePublishVectors(feds.vFed, vpubs, [1 4; 2 5; 3 6]);
+    helicsFederateRequestTime(feds.vFed, 1.0);
+    testCase.verifyEqual(helicsInputGetDouble(subs(1)),1.5);
+    testCase.verifyEqual(helicsInputGetDouble(subs(2)),-2.25);
+    testCase.verifyEqual(helicsInputGetVector(vsubs(1)),[1;2;3]);
+    testCase.verifyEqual(helicsInputGetVector(vsubs(2)),[4;5;6]);
+
+    helicsFederatePublishVectors(feds.vFed, vpubs, {[7 8], 9});
+    helicsFederateRequestTime(feds.vFed, 2.0);
+    testCase.verifyEqual(helicsInputGetVector(vsubs(1)),[7;8]);
+    testCase.verifyEqual(helicsInputGetVector(vsubs(2)),9);
+
+    helicsFederatePublishComplexVectors(feds.vFed, cpubs, [1+2i 3; 4 5-6i]);
+    helicsFederateRequestTime(feds.vFed, 3.0);
+    testCase.verifyEqual(helicsInputGetComplexVector(csubs(1)),[1+2i;4]);
+    testCase.verifyEqual(helicsInputGetComplexVector(csubs(2)),[3;5-6i]);
+
+    % a real matrix is published with zero imaginary parts, like the cell form
+    helicsFederatePublishComplexVectors(feds.vFed, cpubs, [1 3; 2 4]);
+    helicsFederateRequestTime(feds.vFed, 4.0);
+    testCase.verifyEqual(helicsInputGetComplexVector(csubs(1)),complex([1;2]));
+    testCase.verifyEqual(helicsInputGetComplexVector(csubs(2)),complex([3;4]));
+
+    testCase.verifyError(@()helicsFederatePublishDoubles(feds.vFed, pubs, 1.0),'MATLAB:helicsFederatePublishDoubles:TypeError');
+    testCase.verifyError(@()helicsFederatePublishComplexVectors(feds.vFed, cpubs, int32([1 2])),'MATLAB:helicsFederatePublishComplexVectors:TypeError');
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testBulkInput(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    pubs = [helicsFederateRegisterGlobalPublication(feds.vFed, 'pub1', HelicsDataTypes.HELICS_DATA_TYPE_DOUBLE, ''),...
+        helicsFederateRegisterGlobalPublication(feds.vFed, 'pub2', HelicsDataTypes.HELICS_DATA_TYPE_DOUBLE, '')];
+    subs = [helicsFederateRegisterSubscription(feds.vFed, 'pub1', ''),...
+        helicsFederateRegisterSubscription(feds.vFed, 'pub2', '')];
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    helicsFederatePublishDoubles(feds.vFed, pubs, [3.5, 4.5]);
+    helicsFederateRequestTime(feds.vFed, 1.0);
+    helicsPublicationPublishDouble(pubs(2), 5.5);
+    [values,updated] = helicsFederateGetInputDoubles(feds.vFed, subs, true);
+    testCase.verifyEqual(values,[3.5;4.5]);
+    testCase.verifyEqual(updated,[true;true]);
+
+    helicsFederateRequestTime(feds.vFed, 2.0);
+    [values,updated] = helicsFederateGetInputDoubles(feds.vFed, subs);
+    testCase.verifyEqual(values,[3.5;5.5]);
+    testCase.verifyEqual(updated,[false;true]);
+
+    testCase.verifyError(@()helicsFederateGetInputDoubles(feds.vFed, subs, 2),'MATLAB:helicsFederateGetInputDoubles:TypeError');
+    testCase.verifyError(@()helicsFederateGetInputDoubles(feds.vFed, subs, []),'MATLAB:helicsFederateGetInputDoubles:TypeError');
+    testCase.verifyError(@()helicsFederateGetInputDoubles(feds.vFed, subs, [true false]),'MATLAB:helicsFederateGetInputDoubles:TypeError');
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testRawBytes(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    defaultValue = uint8([9 0 9]);
+    testValue = uint8([0 200 0 1 255]);
+
+    pubid = helicsFederateRegisterGlobalPublication(feds.vFed, 'pub1', HelicsDataTypes.HELICS_DATA_TYPE_RAW, '');
+    subid = helicsFederateRegisterSubscription(feds.vFed, 'pub1', '');
+    helicsInputSetDefaultBytes(subid, defaultValue);
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    testCase.verifyEqual(helicsInputGetRawBytes(subid),defaultValue);
+
+    helicsPublicationPublishBytes(pubid, testValue);
+    helicsFederateRequestTime(feds.vFed, 1.0);
+    testCase.verifyEqual(helicsInputGetRawBytes(subid),testValue);
+    testCase.verifyEqual(double(helicsInputGetBytes(subid)),double(testValue));
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testPublishDispatch(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    pubid = helicsFederateRegisterGlobalPublication(feds.vFed, 'pub1', HelicsDataTypes.HELICS_DATA_TYPE_ANY, '');
+    subid = helicsFederateRegisterSubscription(feds.vFed, 'pub1', '');
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    helicsPublicationPublish(pubid, 2.5);
+    helicsFederateRequestTime(feds.vFed, 1.0);
+    testCase.verifyEqual(helicsInputGetDouble(subid),2.5);
+
+    helicsPublicationPublish(pubid, single([1 2 3]));
+    helicsFederateRequestTime(feds.vFed, 2.0);
+    testCase.verifyEqual(helicsInputGetVector(subid),[1;2;3]);
+
+    helicsPublicationPublish(pubid, int32(-7));
+    helicsFederateRequestTime(feds.vFed, 3.0);
+    testCase.verifyEqual(helicsInputGetInteger(subid),int64(-7));
+
+    helicsPublicationPublish(pubid, 3-4i);
+    helicsFederateRequestTime(feds.vFed, 4.0);
+    testCase.verifyEqual(helicsInputGetComplex(subid),3-4i);
+
+    helicsPublicationPublish(pubid, 'a string');
+    helicsFederateRequestTime(feds.vFed, 5.0);
+    testCase.verifyEqual(helicsInputGetString(subid),'a string');
+
+    helicsPublicationPublish(pubid, true);
+    helicsFederateRequestTime(feds.vFed, 6.0);
+    testCase.verifyEqual(helicsInputGetBoolean(subid),HELICS_TRUE);
+
+    helicsPublicationPublish(pubid, {'voltage', 1.05});
+    helicsFederateRequestTime(feds.vFed, 7.0);
+    [name,val] = helicsInputGetNamedPoint(subid);
+    testCase.verifyEqual(name,'voltage');
+    testCase.verifyEqual(val,1.05);
+
+    helicsPublicationPublish(pubid, {'a','b"c'});
+    helicsFederateRequestTime(feds.vFed, 8.0);
+    testCase.verifyEqual(helicsInputGetString(subid),'["a","b\"c"]');
+
+    helicsPublicationPublish(pubid, {['bell' char(7)], sprintf('x\ty')});
+    helicsFederateRequestTime(feds.vFed, 9.0);
+    testCase.verifyEqual(helicsInputGetString(subid),'["bell\u0007","x\ty"]');
+    testCase.verifyEqual(jsondecode(helicsInputGetString(subid)),{['bell' char(7)]; sprintf('x\ty')});
+
+    testCase.verifyError(@()helicsPublicationPublish(pubid, struct('a',1)),'MATLAB:helicsPublicationPublish:TypeError');
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testGetValue(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    dpub = helicsFederateRegisterGlobalPublication(feds.vFed, 'dpub', HelicsDataTypes.HELICS_DATA_TYPE_DOUBLE, '');
+    ipub = helicsFederateRegisterGlobalPublication(feds.vFed, 'ipub', HelicsDataTypes.HELICS_DATA_TYPE_INT, '');
+    cvpub = helicsFederateRegisterGlobalPublication(feds.vFed, 'cvpub', HelicsDataTypes.HELICS_DATA_TYPE_COMPLEX_VECTOR, '');
+    npub = helicsFederateRegisterGlobalPublication(feds.vFed, 'npub', HelicsDataTypes.HELICS_DATA_TYPE_NAMED_POINT, '');
+    spub = helicsFederateRegisterGlobalPublication(feds.vFed, 'spub', HelicsDataTypes.HELICS_DATA_TYPE_STRING, '');
+    dsub = helicsFederateRegisterSubscription(feds.vFed, 'dpub', '');
+    isub = helicsFederateRegisterSubscription(feds.vFed, 'ipub', '');
+    cvsub = helicsFederateRegisterSubscription(feds.vFed, 'cvpub', '');
+    nsub = helicsFederateRegisterSubscription(feds.vFed, 'npub', '');
+    ssub = helicsFederateRegisterSubscription(feds.vFed, 'spub', '');
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    helicsPublicationPublishDouble(dpub, 4.5);
+    helicsPublicationPublishInteger(ipub, int64(12));
+    helicsPublicationPublishComplexVector(cvpub, [1+1i 2-2i]);
+    helicsPublicationPublishNamedPoint(npub, 'current', -3.25);
+    helicsPublicationPublishString(spub, 'text value');
+    helicsFederateRequestTime(feds.vFed, 1.0);
+
+    [value,dataType] = helicsInputGetValue(dsub);
+    testCase.verifyEqual(value,4.5);
+    testCase.verifyEqual(dataType,HelicsDataTypes.HELICS_DATA_TYPE_DOUBLE);
+    testCase.verifyEqual(helicsInputGetValue(isub),int64(12));
+    testCase.verifyEqual(helicsInputGetValue(cvsub),[1+1i;2-2i]);
+    testCase.verifyEqual(helicsInputGetValue(nsub),struct('name','current','value',-3.25));
+    testCase.verifyEqual(helicsInputGetValue(ssub),'text value');
+
+    % the cached type is used on later reads
+    helicsPublicationPublishDouble(dpub, -1.0);
+    helicsFederateRequestTime(feds.vFed, 2.0);
+    testCase.verifyEqual(helicsInputGetValue(dsub),-1.0);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+
+    % the cached types go with the federate, the same keys with other types read correctly
+    [feds,success]=generateFed();
+    testCase.verifyThat(success,IsTrue);
+    dpub = helicsFederateRegisterGlobalPublication(feds.vFed, 'dpub', HelicsDataTypes.HELICS_DATA_TYPE_STRING, '');
+    dsub = helicsFederateRegisterSubscription(feds.vFed, 'dpub', '');
+    helicsFederateEnterExecutingMode(feds.vFed);
+    helicsPublicationPublishString(dpub, 'after restart');
+    helicsFederateRequestTime(feds.vFed, 1.0);
+    [value,dataType] = helicsInputGetValue(dsub);
+    testCase.verifyEqual(value,'after restart');
+    testCase.verifyEqual(dataType,HelicsDataTypes.HELICS_DATA_TYPE_STRING);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function count=countLogMessages(action)
+persistent messageCount;
+if (isempty(messageCount))
+    messageCount=0;
+end
+if (nargin > 0)
+    if (strcmp(action,'reset'))
+        messageCount=0;
+    else
+        messageCount=messageCount+1;
+    end
+end
+count=messageCount;
+end
+
+function testCallbackQueueStress(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    messageTotal = 5000;
+    countLogMessages('reset');
+    helicsFederateSetLoggingCallback(feds.vFed, @(loglevel,identifier,message) countLogMessages('add'));
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    % log messages are raised on the HELICS core thread and queued until the MATLAB thread drains them
+    starttime = tic;
+    for ii=1:messageTotal
+        helicsFederateLogWarningMessage(feds.vFed, sprintf('stress message %d', ii));
+    end
+    while (countLogMessages() < messageTotal && toc(starttime) < 30)
+        helicsMex('__pump', 100);
+    end
+    testCase.verifyGreaterThanOrEqual(countLogMessages(),messageTotal);
+
+    % queued callbacks are also run while waiting for a time grant
+    countLogMessages('reset');
+    helicsFederateLogWarningMessage(feds.vFed, 'before time request');
+    helicsFederateRequestTime(feds.vFed, 1.0);
+    helicsMex('__pump');
+    testCase.verifyGreaterThanOrEqual(countLogMessages(),1);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testLoggingBuffer(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    % only warnings containing 'keep' are buffered
+    helicsFederateSetLoggingBuffer(feds.vFed, struct('level', HelicsLogLevels.HELICS_LOG_LEVEL_WARNING, 'pattern', 'keep', 'capacity', 3));
+    helicsFederateEnterExecutingMode(feds.vFed);
+    for ii=1:5
+        helicsFederateLogWarningMessage(feds.vFed, sprintf('keep %d', ii));
+        helicsFederateLogWarningMessage(feds.vFed, sprintf('discard %d', ii));
+    end
+    helicsFederateLogDebugMessage(feds.vFed, 'keep debug');
+    helicsFederateRequestTime(feds.vFed, 1.0);
+    [entries,dropped] = helicsLoggingBufferDrain(feds.vFed);
+    testCase.verifyEqual(numel(entries),3);
+    testCase.verifyEqual(dropped,2);
+    testCase.verifyTrue(contains(entries(end).message,'keep 5'));
+    testCase.verifyEqual(numel(helicsLoggingBufferDrain(feds.vFed)),0);
+
+    % batches of messages are delivered to a callback with a single call
+    countLogMessages('reset');
+    helicsFederateSetLoggingBuffer(feds.vFed, struct('pattern', 'batch', 'callback', @(entries,dropped) countLogMessages('add'), 'batchSize', 10));
+    for ii=1:20
+        helicsFederateLogWarningMessage(feds.vFed, sprintf('batch %d', ii));
+    end
+    helicsFederateRequestTime(feds.vFed, 2.0);
+    starttime = tic;
+    while (countLogMessages() < 1 && toc(starttime) < 10)
+        helicsMex('__pump', 100);
+    end
+    testCase.verifyGreaterThanOrEqual(countLogMessages(),1);
+    testCase.verifyLessThanOrEqual(countLogMessages(),2);
+    testCase.verifyEqual(numel(helicsLoggingBufferDrain(feds.vFed)),0);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+    % the buffer is removed with the federate
+    testCase.verifyError(@() helicsLoggingBufferDrain(feds.vFed),'MATLAB:helicsLoggingBufferDrain:TypeError');
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function caught=callbackErrorCaught()
+caught=0;
+try
+    helics.helicsInputGetDouble();
+catch
+    caught=1;
+end
+end
+
+function values=recordCallbackValues(value)
+persistent recorded;
+if (nargin > 0)
+    if (ischar(value))
+        recorded=[];
+    else
+        recorded(end+1)=value;
+    end
+end
+values=recorded;
+end
+
+function testCallbackArgumentReuse(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    % the argument arrays are reused for every call so each call must see its own time
+    recordCallbackValues('reset');
+    helicsFederateSetTimeUpdateCallback(feds.vFed, @(newTime,iterating) recordCallbackValues(newTime));
+    helicsFederateEnterExecutingMode(feds.vFed);
+    for ii=1:5
+        helicsFederateRequestTime(feds.vFed, ii);
+    end
+    helicsMex('__pump');
+    values=recordCallbackValues();
+    testCase.verifyGreaterThanOrEqual(numel(values),5);
+    testCase.verifyEqual(values(end-4:end),1:5);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testCallbackRegistry(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    recordCallbackValues('reset');
+    firstId = helicsFederateSetTimeUpdateCallback(feds.vFed, @(newTime,iterating) recordCallbackValues(-newTime));
+    % setting the callback again replaces it and gives it a new id
+    id = helicsFederateSetTimeUpdateCallback(feds.vFed, @(newTime,iterating) recordCallbackValues(newTime));
+    testCase.verifyNotEqual(id,firstId);
+    helicsFederateEnterExecutingMode(feds.vFed);
+    for ii=1:3
+        helicsFederateRequestTime(feds.vFed, ii);
+    end
+    helicsMex('__pump');
+    testCase.verifyTrue(all(recordCallbackValues() >= 0));
+
+    stats = helicsCallbackGetStatistics(id);
+    testCase.verifyEqual(numel(stats),1);
+    testCase.verifyEqual(stats.setter,'helicsFederateSetTimeUpdateCallback');
+    testCase.verifyGreaterThanOrEqual(stats.calls,3);
+    testCase.verifyGreaterThanOrEqual(stats.totalSeconds,stats.maxSeconds);
+    testCase.verifyError(@() helicsCallbackGetStatistics(firstId),'MATLAB:helicsCallbackGetStatistics:TypeError');
+
+    % a removed callback is no longer called
+    helicsCallbackRemove(id);
+    recordCallbackValues('reset');
+    helicsFederateRequestTime(feds.vFed, 4);
+    helicsMex('__pump');
+    testCase.verifyEmpty(recordCallbackValues());
+    testCase.verifyError(@() helicsCallbackGetStatistics(id),'MATLAB:helicsCallbackGetStatistics:TypeError');
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testQueryResponses(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    helicsFederateSetQueryResponse(feds.vFed, 'status', 'running');
+    helicsFederateSetQueryResponse(feds.vFed, 'load', 42.5);
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    % the answers come from the native table while MATLAB is blocked in the query
+    query = helicsCreateQuery('fed1', 'status');
+    testCase.verifyEqual(helicsQueryExecute(query, feds.vFed), 'running');
+    helicsQueryFree(query);
+    query = helicsCreateQuery('fed1', 'load');
+    testCase.verifyEqual(str2double(helicsQueryExecute(query, feds.vFed)), 42.5);
+    helicsFederateSetQueryResponse(feds.vFed, 'load', [1 2]);
+    testCase.verifyEqual(jsondecode(helicsQueryExecute(query, feds.vFed)), [1;2]);
+    helicsQueryFree(query);
+
+    helicsFederateClearQueryResponses(feds.vFed);
+    query = helicsCreateQuery('fed1', 'status');
+    testCase.verifyNotEqual(helicsQueryExecute(query, feds.vFed), 'running');
+    helicsQueryFree(query);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+
+    % the answers go with the federate, a new federate gets its own even if it reuses the address
+    [feds,success]=generateFed();
+    testCase.verifyThat(success,IsTrue);
+    helicsFederateSetQueryResponse(feds.vFed, 'status', 'restarted');
+    helicsFederateEnterExecutingMode(feds.vFed);
+    query = helicsCreateQuery('fed1', 'status');
+    testCase.verifyEqual(helicsQueryExecute(query, feds.vFed), 'restarted');
+    helicsQueryFree(query);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testQueryCallback(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    helicsFederateSetQueryCallback(feds.vFed, @(query,querySize,buffer) helicsQueryBufferFill(buffer, ['answer:' query]));
+    % the callback runs on the MATLAB thread while the mode change and the query block
+    helicsFederateEnterExecutingMode(feds.vFed);
+    query = helicsCreateQuery('fed1', 'custom');
+    testCase.verifyEqual(helicsQueryExecute(query, feds.vFed), 'answer:custom');
+
+    % an error in the callback is raised once the query has completed
+    helicsFederateSetQueryCallback(feds.vFed, @(query,querySize,buffer) error('test:queryCallback','failed'));
+    try
+        helicsQueryExecute(query, feds.vFed);
+        testCase.verifyThat(false,IsTrue);
+    catch e
+        testCase.verifyEqual(e.identifier,'test:queryCallback');
+    end
+    helicsQueryFree(query);
+    helicsFederateRequestTime(feds.vFed, 1.0);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end
+
+function testPlayer(testCase)
+import matlab.unittest.constraints.IsTrue;
+import helics.*
+[feds,success]=generateFed();
+testCase.verifyThat(success,IsTrue);
+
+try
+    pub1 = helicsFederateRegisterGlobalPublication(feds.vFed, 'pub1', HelicsDataTypes.HELICS_DATA_TYPE_DOUBLE, '');
+    pub2 = helicsFederateRegisterGlobalPublication(feds.vFed, 'pub2', HelicsDataTypes.HELICS_DATA_TYPE_DOUBLE, '');
+    sub1 = helicsFederateRegisterSubscription(feds.vFed, 'pub1', '');
+    sub2 = helicsFederateRegisterSubscription(feds.vFed, 'pub2', '');
+    helicsFederateEnterExecutingMode(feds.vFed);
+
+    id = helicsFederateRunPlayer(feds.vFed, [pub1,pub2], [1;2;3], [1 10;2 20;3 30]);
+    status = helicsPlayerWait(id, 10000);
+    testCase.verifyFalse(status.running);
+    testCase.verifyEqual(status.step,3);
+    testCase.verifyEqual(status.time,3);
+    testCase.verifyEmpty(status.error);
+    testCase.verifyError(@() helicsPlayerGetStatus(id),'MATLAB:helicsPlayerGetStatus:TypeError');
+
+    helicsFederateRequestTime(feds.vFed, 4);
+    testCase.verifyEqual(helicsInputGetDouble(sub1),3);
+    testCase.verifyEqual(helicsInputGetDouble(sub2),30);
+
+    % a stopped player ends before its last step
+    id = helicsFederateRunPlayer(feds.vFed, pub1, (5:10004)', (5:10004)');
+    helicsPlayerStop(id);
+    status = helicsPlayerWait(id);
+    testCase.verifyFalse(status.running);
+    testCase.verifyLessThan(status.step,10000);
+    success=closeStruct(feds);
+    testCase.verifyThat(success,IsTrue);
+catch e
+    testCase.verifyThat(false,IsTrue);
+    disp(e.message)
+    disp(e.stack(1))
+    forceCloseStruct(feds);
+end
+end